@@ -0,0 +1,1049 @@
+# DO NOT EDIT THIS FILE
+# It is autogenerated by make/calcdep.pl, and will be overwritten
+# every time you rerun make in the main directory
+VPATH = $(SOURCEPATH)/src
+
+bad-target:
+	@echo "This Makefile must be run by a sub-make from the source"
+	@echo "in order to set the correct environment variables"
+	@exit 1
+
+all: inspircd modules
+
+obj/bancache.o: bancache.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/bancache.cpp $>
+obj/base.o: base.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/base.cpp $>
+obj/channels.o: channels.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/extban.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/channels.cpp $>
+obj/cidr.o: cidr.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/cidr.cpp $>
+obj/clientprotocol.o: clientprotocol.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/clientprotocol.cpp $>
+obj/command_parse.o: command_parse.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/command_parse.cpp $>
+obj/commands.o: commands.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/commands.cpp $>
+obj/configparser.o: configparser.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configparser.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/configparser.cpp $>
+obj/configreader.o: configreader.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configparser.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/exitcodes.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/configreader.cpp $>
+obj/cull_list.o: cull_list.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/cull_list.cpp $>
+obj/dynamic.o: dynamic.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/dynamic.cpp $>
+obj/extensible.o: extensible.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/extensible.cpp $>
+obj/filelogger.o: filelogger.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/filelogger.cpp $>
+obj/fileutils.o: fileutils.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/fileutils.cpp $>
+obj/hashcomp.o: hashcomp.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/hashcomp.cpp $>
+obj/helperfuncs.o: helperfuncs.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/exitcodes.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/helperfuncs.cpp $>
+obj/inspircd.o: inspircd.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/exitcodes.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/inspircd.cpp $>
+obj/inspsocket.o: inspsocket.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/inspsocket.cpp $>
+obj/inspstring.o: inspstring.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/inspstring.cpp $>
+obj/listensocket.o: listensocket.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/listensocket.cpp $>
+obj/listmode.o: listmode.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/listmode.cpp $>
+obj/logger.o: logger.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/logger.cpp $>
+obj/mode.o: mode.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/mode.cpp $>
+obj/modulemanager.o: modulemanager.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/exitcodes.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modulemanager.cpp $>
+obj/modules.o: modules.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/exitcodes.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules.cpp $>
+obj/serializable.o: serializable.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/serializable.cpp $>
+obj/server.o: server.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/exitcodes.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/server.cpp $>
+obj/snomasks.o: snomasks.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/snomasks.cpp $>
+obj/socket.o: socket.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/socket.cpp $>
+obj/socketengine.o: socketengine.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/exitcodes.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/socketengine.cpp $>
+obj/thread.o: thread.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/thread.cpp $>
+obj/threadsocket.o: threadsocket.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/threadsocket.cpp $>
+obj/timer.o: timer.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/timer.cpp $>
+obj/usermanager.o: usermanager.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/usermanager.cpp $>
+obj/users.o: users.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/users.cpp $>
+obj/wildcard.o: wildcard.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/wildcard.cpp $>
+obj/xline.o: xline.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/xline.cpp $>
+obj/socketengine_epoll.o: socketengines/socketengine_epoll.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/socketengines/socketengine_epoll.cpp $>
+obj/socketengine_kqueue.o: socketengines/socketengine_kqueue.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/socketengines/socketengine_kqueue.cpp $>
+obj/socketengine_poll.o: socketengines/socketengine_poll.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/socketengines/socketengine_poll.cpp $>
+obj/socketengine_select.o: socketengines/socketengine_select.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/socketengines/socketengine_select.cpp $>
+obj/bench/primitives.o: bench/primitives.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/bench/primitives.cpp $>
+obj/core_channel/cmd_invite.o: coremods/core_channel/cmd_invite.cpp coremods/core_channel/core_channel.h coremods/core_channel/invite.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/exemption.h include/modules/extban.h include/modules/invite.h include/modules/names.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_channel/cmd_invite.cpp $>
+obj/core_channel/cmd_join.o: coremods/core_channel/cmd_join.cpp coremods/core_channel/core_channel.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/exemption.h include/modules/extban.h include/modules/names.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_channel/cmd_join.cpp $>
+obj/core_channel/cmd_kick.o: coremods/core_channel/cmd_kick.cpp coremods/core_channel/core_channel.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/exemption.h include/modules/extban.h include/modules/names.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_channel/cmd_kick.cpp $>
+obj/core_channel/cmd_names.o: coremods/core_channel/cmd_names.cpp coremods/core_channel/core_channel.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/exemption.h include/modules/extban.h include/modules/names.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_channel/cmd_names.cpp $>
+obj/core_channel/cmd_topic.o: coremods/core_channel/cmd_topic.cpp coremods/core_channel/core_channel.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/exemption.h include/modules/extban.h include/modules/names.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_channel/cmd_topic.cpp $>
+obj/core_channel/cmode_k.o: coremods/core_channel/cmode_k.cpp coremods/core_channel/core_channel.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/exemption.h include/modules/extban.h include/modules/names.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_channel/cmode_k.cpp $>
+obj/core_channel/cmode_l.o: coremods/core_channel/cmode_l.cpp coremods/core_channel/core_channel.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/exemption.h include/modules/extban.h include/modules/names.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_channel/cmode_l.cpp $>
+obj/core_channel/core_channel.o: coremods/core_channel/core_channel.cpp coremods/core_channel/core_channel.h coremods/core_channel/invite.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/exemption.h include/modules/extban.h include/modules/invite.h include/modules/isupport.h include/modules/names.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_channel/core_channel.cpp $>
+obj/core_channel/extban.o: coremods/core_channel/extban.cpp coremods/core_channel/core_channel.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/exemption.h include/modules/extban.h include/modules/names.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_channel/extban.cpp $>
+obj/core_channel/invite.o: coremods/core_channel/invite.cpp coremods/core_channel/invite.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/invite.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_channel/invite.cpp $>
+.PHONY: core_channel
+core_channel: modules/core_channel.so
+modules/core_channel.so: obj/core_channel/cmd_invite.o obj/core_channel/cmd_join.o obj/core_channel/cmd_kick.o obj/core_channel/cmd_names.o obj/core_channel/cmd_topic.o obj/core_channel/cmode_k.o obj/core_channel/cmode_l.o obj/core_channel/core_channel.o obj/core_channel/extban.o obj/core_channel/invite.o
+	@$(SOURCEPATH)/make/unit-cc.pl link-dir $@ /root/repo/src/coremods/core_channel $^ $>
+.PHONY: core_dns
+core_dns: modules/core_dns.so
+modules/core_dns.so: coremods/core_dns.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/dns.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/coremods/core_dns.cpp $>
+.PHONY: core_hostname_lookup
+core_hostname_lookup: modules/core_hostname_lookup.so
+modules/core_hostname_lookup.so: coremods/core_hostname_lookup.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/dns.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/coremods/core_hostname_lookup.cpp $>
+obj/core_info/cmd_admin.o: coremods/core_info/cmd_admin.cpp coremods/core_info/core_info.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/isupport.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_info/cmd_admin.cpp $>
+obj/core_info/cmd_commands.o: coremods/core_info/cmd_commands.cpp coremods/core_info/core_info.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/isupport.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_info/cmd_commands.cpp $>
+obj/core_info/cmd_info.o: coremods/core_info/cmd_info.cpp coremods/core_info/core_info.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/isupport.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_info/cmd_info.cpp $>
+obj/core_info/cmd_modules.o: coremods/core_info/cmd_modules.cpp coremods/core_info/core_info.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/isupport.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_info/cmd_modules.cpp $>
+obj/core_info/cmd_motd.o: coremods/core_info/cmd_motd.cpp coremods/core_info/core_info.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/isupport.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_info/cmd_motd.cpp $>
+obj/core_info/cmd_servlist.o: coremods/core_info/cmd_servlist.cpp coremods/core_info/core_info.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/isupport.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_info/cmd_servlist.cpp $>
+obj/core_info/cmd_time.o: coremods/core_info/cmd_time.cpp coremods/core_info/core_info.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/isupport.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_info/cmd_time.cpp $>
+obj/core_info/cmd_version.o: coremods/core_info/cmd_version.cpp coremods/core_info/core_info.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/isupport.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_info/cmd_version.cpp $>
+obj/core_info/core_info.o: coremods/core_info/core_info.cpp coremods/core_info/core_info.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/isupport.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_info/core_info.cpp $>
+obj/core_info/isupport.o: coremods/core_info/isupport.cpp coremods/core_info/core_info.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/isupport.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_info/isupport.cpp $>
+.PHONY: core_info
+core_info: modules/core_info.so
+modules/core_info.so: obj/core_info/cmd_admin.o obj/core_info/cmd_commands.o obj/core_info/cmd_info.o obj/core_info/cmd_modules.o obj/core_info/cmd_motd.o obj/core_info/cmd_servlist.o obj/core_info/cmd_time.o obj/core_info/cmd_version.o obj/core_info/core_info.o obj/core_info/isupport.o
+	@$(SOURCEPATH)/make/unit-cc.pl link-dir $@ /root/repo/src/coremods/core_info $^ $>
+.PHONY: core_list
+core_list: modules/core_list.so
+modules/core_list.so: coremods/core_list.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/isupport.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/coremods/core_list.cpp $>
+.PHONY: core_loadmodule
+core_loadmodule: modules/core_loadmodule.so
+modules/core_loadmodule.so: coremods/core_loadmodule.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/coremods/core_loadmodule.cpp $>
+.PHONY: core_lusers
+core_lusers: modules/core_lusers.so
+modules/core_lusers.so: coremods/core_lusers.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/server.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/coremods/core_lusers.cpp $>
+.PHONY: core_message
+core_message: modules/core_message.so
+modules/core_message.so: coremods/core_message.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/coremods/core_message.cpp $>
+.PHONY: core_mode
+core_mode: modules/core_mode.so
+modules/core_mode.so: coremods/core_mode.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/isupport.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/coremods/core_mode.cpp $>
+obj/core_oper/cmd_die.o: coremods/core_oper/cmd_die.cpp coremods/core_oper/core_oper.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/exitcodes.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_oper/cmd_die.cpp $>
+obj/core_oper/cmd_kill.o: coremods/core_oper/cmd_kill.cpp coremods/core_oper/core_oper.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_oper/cmd_kill.cpp $>
+obj/core_oper/cmd_oper.o: coremods/core_oper/cmd_oper.cpp coremods/core_oper/core_oper.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_oper/cmd_oper.cpp $>
+obj/core_oper/cmd_rehash.o: coremods/core_oper/cmd_rehash.cpp coremods/core_oper/core_oper.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_oper/cmd_rehash.cpp $>
+obj/core_oper/cmd_restart.o: coremods/core_oper/cmd_restart.cpp coremods/core_oper/core_oper.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_oper/cmd_restart.cpp $>
+obj/core_oper/core_oper.o: coremods/core_oper/core_oper.cpp coremods/core_oper/core_oper.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_oper/core_oper.cpp $>
+obj/core_oper/umode_o.o: coremods/core_oper/umode_o.cpp coremods/core_oper/core_oper.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_oper/umode_o.cpp $>
+obj/core_oper/umode_s.o: coremods/core_oper/umode_s.cpp coremods/core_oper/core_oper.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_oper/umode_s.cpp $>
+.PHONY: core_oper
+core_oper: modules/core_oper.so
+modules/core_oper.so: obj/core_oper/cmd_die.o obj/core_oper/cmd_kill.o obj/core_oper/cmd_oper.o obj/core_oper/cmd_rehash.o obj/core_oper/cmd_restart.o obj/core_oper/core_oper.o obj/core_oper/umode_o.o obj/core_oper/umode_s.o
+	@$(SOURCEPATH)/make/unit-cc.pl link-dir $@ /root/repo/src/coremods/core_oper $^ $>
+.PHONY: core_reloadmodule
+core_reloadmodule: modules/core_reloadmodule.so
+modules/core_reloadmodule.so: coremods/core_reloadmodule.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/reload.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/coremods/core_reloadmodule.cpp $>
+.PHONY: core_serialize_rfc
+core_serialize_rfc: modules/core_serialize_rfc.so
+modules/core_serialize_rfc.so: coremods/core_serialize_rfc.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/coremods/core_serialize_rfc.cpp $>
+.PHONY: core_stats
+core_stats: modules/core_stats.so
+modules/core_stats.so: coremods/core_stats.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/coremods/core_stats.cpp $>
+.PHONY: core_stub
+core_stub: modules/core_stub.so
+modules/core_stub.so: coremods/core_stub.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/coremods/core_stub.cpp $>
+obj/core_user/cmd_away.o: coremods/core_user/cmd_away.cpp coremods/core_user/core_user.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_user/cmd_away.cpp $>
+obj/core_user/cmd_ison.o: coremods/core_user/cmd_ison.cpp coremods/core_user/core_user.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_user/cmd_ison.cpp $>
+obj/core_user/cmd_nick.o: coremods/core_user/cmd_nick.cpp coremods/core_user/core_user.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_user/cmd_nick.cpp $>
+obj/core_user/cmd_part.o: coremods/core_user/cmd_part.cpp coremods/core_user/core_user.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_user/cmd_part.cpp $>
+obj/core_user/cmd_quit.o: coremods/core_user/cmd_quit.cpp coremods/core_user/core_user.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_user/cmd_quit.cpp $>
+obj/core_user/cmd_user.o: coremods/core_user/cmd_user.cpp coremods/core_user/core_user.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_user/cmd_user.cpp $>
+obj/core_user/cmd_userhost.o: coremods/core_user/cmd_userhost.cpp coremods/core_user/core_user.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_user/cmd_userhost.cpp $>
+obj/core_user/core_user.o: coremods/core_user/core_user.cpp coremods/core_user/core_user.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_user/core_user.cpp $>
+.PHONY: core_user
+core_user: modules/core_user.so
+modules/core_user.so: obj/core_user/cmd_away.o obj/core_user/cmd_ison.o obj/core_user/cmd_nick.o obj/core_user/cmd_part.o obj/core_user/cmd_quit.o obj/core_user/cmd_user.o obj/core_user/cmd_userhost.o obj/core_user/core_user.o
+	@$(SOURCEPATH)/make/unit-cc.pl link-dir $@ /root/repo/src/coremods/core_user $^ $>
+.PHONY: core_wallops
+core_wallops: modules/core_wallops.so
+modules/core_wallops.so: coremods/core_wallops.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/coremods/core_wallops.cpp $>
+.PHONY: core_who
+core_who: modules/core_who.so
+modules/core_who.so: coremods/core_who.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/account.h include/modules/isupport.h include/modules/who.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/coremods/core_who.cpp $>
+.PHONY: core_whois
+core_whois: modules/core_whois.so
+modules/core_whois.so: coremods/core_whois.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/whois.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/coremods/core_whois.cpp $>
+.PHONY: core_whowas
+core_whowas: modules/core_whowas.so
+modules/core_whowas.so: coremods/core_whowas.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/coremods/core_whowas.cpp $>
+obj/core_xline/cmd_eline.o: coremods/core_xline/cmd_eline.cpp coremods/core_xline/core_xline.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_xline/cmd_eline.cpp $>
+obj/core_xline/cmd_gline.o: coremods/core_xline/cmd_gline.cpp coremods/core_xline/core_xline.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_xline/cmd_gline.cpp $>
+obj/core_xline/cmd_kline.o: coremods/core_xline/cmd_kline.cpp coremods/core_xline/core_xline.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_xline/cmd_kline.cpp $>
+obj/core_xline/cmd_qline.o: coremods/core_xline/cmd_qline.cpp coremods/core_xline/core_xline.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_xline/cmd_qline.cpp $>
+obj/core_xline/cmd_zline.o: coremods/core_xline/cmd_zline.cpp coremods/core_xline/core_xline.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_xline/cmd_zline.cpp $>
+obj/core_xline/core_xline.o: coremods/core_xline/core_xline.cpp coremods/core_xline/core_xline.h include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/coremods/core_xline/core_xline.cpp $>
+.PHONY: core_xline
+core_xline: modules/core_xline.so
+modules/core_xline.so: obj/core_xline/cmd_eline.o obj/core_xline/cmd_gline.o obj/core_xline/cmd_kline.o obj/core_xline/cmd_qline.o obj/core_xline/cmd_zline.o obj/core_xline/core_xline.o
+	@$(SOURCEPATH)/make/unit-cc.pl link-dir $@ /root/repo/src/coremods/core_xline $^ $>
+.PHONY: m_abbreviation
+m_abbreviation: modules/m_abbreviation.so
+modules/m_abbreviation.so: modules/m_abbreviation.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_abbreviation.cpp $>
+.PHONY: m_alias
+m_alias: modules/m_alias.so
+modules/m_alias.so: modules/m_alias.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_alias.cpp $>
+.PHONY: m_allowinvite
+m_allowinvite: modules/m_allowinvite.so
+modules/m_allowinvite.so: modules/m_allowinvite.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/extban.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_allowinvite.cpp $>
+.PHONY: m_alltime
+m_alltime: modules/m_alltime.so
+modules/m_alltime.so: modules/m_alltime.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_alltime.cpp $>
+.PHONY: m_anticaps
+m_anticaps: modules/m_anticaps.so
+modules/m_anticaps.so: modules/m_anticaps.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/exemption.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_anticaps.cpp $>
+.PHONY: m_auditorium
+m_auditorium: modules/m_auditorium.so
+modules/m_auditorium.so: modules/m_auditorium.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/exemption.h include/modules/names.h include/modules/who.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_auditorium.cpp $>
+.PHONY: m_autoop
+m_autoop: modules/m_autoop.so
+modules/m_autoop.so: modules/m_autoop.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/extban.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_autoop.cpp $>
+.PHONY: m_banexception
+m_banexception: modules/m_banexception.so
+modules/m_banexception.so: modules/m_banexception.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/extban.h include/modules/isupport.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_banexception.cpp $>
+.PHONY: m_banredirect
+m_banredirect: modules/m_banredirect.so
+modules/m_banredirect.so: modules/m_banredirect.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_banredirect.cpp $>
+.PHONY: m_bcrypt
+m_bcrypt: modules/m_bcrypt.so
+modules/m_bcrypt.so: modules/m_bcrypt.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/hash.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_bcrypt.cpp $>
+.PHONY: m_blockamsg
+m_blockamsg: modules/m_blockamsg.so
+modules/m_blockamsg.so: modules/m_blockamsg.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_blockamsg.cpp $>
+.PHONY: m_blockcolor
+m_blockcolor: modules/m_blockcolor.so
+modules/m_blockcolor.so: modules/m_blockcolor.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/exemption.h include/modules/extban.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_blockcolor.cpp $>
+.PHONY: m_botmode
+m_botmode: modules/m_botmode.so
+modules/m_botmode.so: modules/m_botmode.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/cap.h include/modules/ctctags.h include/modules/isupport.h include/modules/who.h include/modules/whois.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_botmode.cpp $>
+.PHONY: m_callerid
+m_callerid: modules/m_callerid.so
+modules/m_callerid.so: modules/m_callerid.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/callerid.h include/modules/cap.h include/modules/ctctags.h include/modules/isupport.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_callerid.cpp $>
+.PHONY: m_cap
+m_cap: modules/m_cap.so
+modules/m_cap.so: modules/m_cap.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/cap.h include/modules/reload.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_cap.cpp $>
+.PHONY: m_cban
+m_cban: modules/m_cban.so
+modules/m_cban.so: modules/m_cban.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_cban.cpp $>
+.PHONY: m_censor
+m_censor: modules/m_censor.so
+modules/m_censor.so: modules/m_censor.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/exemption.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_censor.cpp $>
+.PHONY: m_cgiirc
+m_cgiirc: modules/m_cgiirc.so
+modules/m_cgiirc.so: modules/m_cgiirc.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/ssl.h include/modules/webirc.h include/modules/whois.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_cgiirc.cpp $>
+.PHONY: m_chancreate
+m_chancreate: modules/m_chancreate.so
+modules/m_chancreate.so: modules/m_chancreate.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_chancreate.cpp $>
+.PHONY: m_chanfilter
+m_chanfilter: modules/m_chanfilter.so
+modules/m_chanfilter.so: modules/m_chanfilter.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/exemption.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_chanfilter.cpp $>
+.PHONY: m_chanhistory
+m_chanhistory: modules/m_chanhistory.so
+modules/m_chanhistory.so: modules/m_chanhistory.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/cap.h include/modules/ircv3_batch.h include/modules/ircv3_servertime.h include/modules/server.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_chanhistory.cpp $>
+.PHONY: m_chanlog
+m_chanlog: modules/m_chanlog.so
+modules/m_chanlog.so: modules/m_chanlog.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_chanlog.cpp $>
+.PHONY: m_channames
+m_channames: modules/m_channames.so
+modules/m_channames.so: modules/m_channames.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_channames.cpp $>
+.PHONY: m_channelban
+m_channelban: modules/m_channelban.so
+modules/m_channelban.so: modules/m_channelban.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/extban.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_channelban.cpp $>
+.PHONY: m_check
+m_check: modules/m_check.so
+modules/m_check.so: modules/m_check.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_check.cpp $>
+.PHONY: m_chghost
+m_chghost: modules/m_chghost.so
+modules/m_chghost.so: modules/m_chghost.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_chghost.cpp $>
+.PHONY: m_chgident
+m_chgident: modules/m_chgident.so
+modules/m_chgident.so: modules/m_chgident.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_chgident.cpp $>
+.PHONY: m_chgname
+m_chgname: modules/m_chgname.so
+modules/m_chgname.so: modules/m_chgname.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_chgname.cpp $>
+.PHONY: m_classban
+m_classban: modules/m_classban.so
+modules/m_classban.so: modules/m_classban.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/extban.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_classban.cpp $>
+.PHONY: m_clearchan
+m_clearchan: modules/m_clearchan.so
+modules/m_clearchan.so: modules/m_clearchan.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_clearchan.cpp $>
+.PHONY: m_cloaking
+m_cloaking: modules/m_cloaking.so
+modules/m_cloaking.so: modules/m_cloaking.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/hash.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_cloaking.cpp $>
+.PHONY: m_clones
+m_clones: modules/m_clones.so
+modules/m_clones.so: modules/m_clones.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/cap.h include/modules/ircv3_batch.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_clones.cpp $>
+.PHONY: m_codepage
+m_codepage: modules/m_codepage.so
+modules/m_codepage.so: modules/m_codepage.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_codepage.cpp $>
+.PHONY: m_commonchans
+m_commonchans: modules/m_commonchans.so
+modules/m_commonchans.so: modules/m_commonchans.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/cap.h include/modules/ctctags.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_commonchans.cpp $>
+.PHONY: m_conn_join
+m_conn_join: modules/m_conn_join.so
+modules/m_conn_join.so: modules/m_conn_join.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_conn_join.cpp $>
+.PHONY: m_conn_umodes
+m_conn_umodes: modules/m_conn_umodes.so
+modules/m_conn_umodes.so: modules/m_conn_umodes.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_conn_umodes.cpp $>
+.PHONY: m_conn_waitpong
+m_conn_waitpong: modules/m_conn_waitpong.so
+modules/m_conn_waitpong.so: modules/m_conn_waitpong.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_conn_waitpong.cpp $>
+.PHONY: m_connectban
+m_connectban: modules/m_connectban.so
+modules/m_connectban.so: modules/m_connectban.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/webirc.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_connectban.cpp $>
+.PHONY: m_connflood
+m_connflood: modules/m_connflood.so
+modules/m_connflood.so: modules/m_connflood.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_connflood.cpp $>
+.PHONY: m_customprefix
+m_customprefix: modules/m_customprefix.so
+modules/m_customprefix.so: modules/m_customprefix.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_customprefix.cpp $>
+.PHONY: m_customtitle
+m_customtitle: modules/m_customtitle.so
+modules/m_customtitle.so: modules/m_customtitle.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/whois.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_customtitle.cpp $>
+.PHONY: m_cycle
+m_cycle: modules/m_cycle.so
+modules/m_cycle.so: modules/m_cycle.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_cycle.cpp $>
+.PHONY: m_dccallow
+m_dccallow: modules/m_dccallow.so
+modules/m_dccallow.so: modules/m_dccallow.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_dccallow.cpp $>
+.PHONY: m_deaf
+m_deaf: modules/m_deaf.so
+modules/m_deaf.so: modules/m_deaf.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_deaf.cpp $>
+.PHONY: m_delayjoin
+m_delayjoin: modules/m_delayjoin.so
+modules/m_delayjoin.so: modules/m_delayjoin.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/cap.h include/modules/ctctags.h include/modules/names.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_delayjoin.cpp $>
+.PHONY: m_delaymsg
+m_delaymsg: modules/m_delaymsg.so
+modules/m_delaymsg.so: modules/m_delaymsg.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/cap.h include/modules/ctctags.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_delaymsg.cpp $>
+.PHONY: m_denychans
+m_denychans: modules/m_denychans.so
+modules/m_denychans.so: modules/m_denychans.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_denychans.cpp $>
+.PHONY: m_disable
+m_disable: modules/m_disable.so
+modules/m_disable.so: modules/m_disable.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_disable.cpp $>
+.PHONY: m_dnsbl
+m_dnsbl: modules/m_dnsbl.so
+modules/m_dnsbl.so: modules/m_dnsbl.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/dns.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_dnsbl.cpp $>
+.PHONY: m_exemptchanops
+m_exemptchanops: modules/m_exemptchanops.so
+modules/m_exemptchanops.so: modules/m_exemptchanops.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/exemption.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_exemptchanops.cpp $>
+.PHONY: m_filter
+m_filter: modules/m_filter.so
+modules/m_filter.so: modules/m_filter.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/account.h include/modules/regex.h include/modules/server.h include/modules/shun.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_filter.cpp $>
+.PHONY: m_gecosban
+m_gecosban: modules/m_gecosban.so
+modules/m_gecosban.so: modules/m_gecosban.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/extban.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_gecosban.cpp $>
+.PHONY: m_geoban
+m_geoban: modules/m_geoban.so
+modules/m_geoban.so: modules/m_geoban.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/extban.h include/modules/geolocation.h include/modules/whois.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_geoban.cpp $>
+.PHONY: m_geoclass
+m_geoclass: modules/m_geoclass.so
+modules/m_geoclass.so: modules/m_geoclass.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/geolocation.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_geoclass.cpp $>
+.PHONY: m_globalload
+m_globalload: modules/m_globalload.so
+modules/m_globalload.so: modules/m_globalload.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_globalload.cpp $>
+.PHONY: m_globops
+m_globops: modules/m_globops.so
+modules/m_globops.so: modules/m_globops.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_globops.cpp $>
+.PHONY: m_haproxy
+m_haproxy: modules/m_haproxy.so
+modules/m_haproxy.so: modules/m_haproxy.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/ssl.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_haproxy.cpp $>
+.PHONY: m_helpop
+m_helpop: modules/m_helpop.so
+modules/m_helpop.so: modules/m_helpop.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/whois.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_helpop.cpp $>
+.PHONY: m_hidechans
+m_hidechans: modules/m_hidechans.so
+modules/m_hidechans.so: modules/m_hidechans.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/whois.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_hidechans.cpp $>
+.PHONY: m_hidelist
+m_hidelist: modules/m_hidelist.so
+modules/m_hidelist.so: modules/m_hidelist.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_hidelist.cpp $>
+.PHONY: m_hidemode
+m_hidemode: modules/m_hidemode.so
+modules/m_hidemode.so: modules/m_hidemode.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_hidemode.cpp $>
+.PHONY: m_hideoper
+m_hideoper: modules/m_hideoper.so
+modules/m_hideoper.so: modules/m_hideoper.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/stats.h include/modules/who.h include/modules/whois.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_hideoper.cpp $>
+.PHONY: m_hostchange
+m_hostchange: modules/m_hostchange.so
+modules/m_hostchange.so: modules/m_hostchange.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/account.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_hostchange.cpp $>
+.PHONY: m_hostcycle
+m_hostcycle: modules/m_hostcycle.so
+modules/m_hostcycle.so: modules/m_hostcycle.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/cap.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_hostcycle.cpp $>
+.PHONY: m_httpd
+m_httpd: modules/m_httpd.so
+modules/m_httpd.so: modules/m_httpd.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/httpd.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_httpd.cpp $>
+.PHONY: m_httpd_acl
+m_httpd_acl: modules/m_httpd_acl.so
+modules/m_httpd_acl.so: modules/m_httpd_acl.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/httpd.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_httpd_acl.cpp $>
+.PHONY: m_httpd_config
+m_httpd_config: modules/m_httpd_config.so
+modules/m_httpd_config.so: modules/m_httpd_config.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/httpd.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_httpd_config.cpp $>
+.PHONY: m_httpd_stats
+m_httpd_stats: modules/m_httpd_stats.so
+modules/m_httpd_stats.so: modules/m_httpd_stats.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/httpd.h include/modules/isupport.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_httpd_stats.cpp $>
+.PHONY: m_ident
+m_ident: modules/m_ident.so
+modules/m_ident.so: modules/m_ident.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_ident.cpp $>
+.PHONY: m_inviteexception
+m_inviteexception: modules/m_inviteexception.so
+modules/m_inviteexception.so: modules/m_inviteexception.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/extban.h include/modules/isupport.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_inviteexception.cpp $>
+.PHONY: m_ircv3
+m_ircv3: modules/m_ircv3.so
+modules/m_ircv3.so: modules/m_ircv3.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/account.h include/modules/away.h include/modules/cap.h include/modules/ircv3.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_ircv3.cpp $>
+.PHONY: m_ircv3_accounttag
+m_ircv3_accounttag: modules/m_ircv3_accounttag.so
+modules/m_ircv3_accounttag.so: modules/m_ircv3_accounttag.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/account.h include/modules/cap.h include/modules/ircv3.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_ircv3_accounttag.cpp $>
+.PHONY: m_ircv3_batch
+m_ircv3_batch: modules/m_ircv3_batch.so
+modules/m_ircv3_batch.so: modules/m_ircv3_batch.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/cap.h include/modules/ircv3_batch.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_ircv3_batch.cpp $>
+.PHONY: m_ircv3_capnotify
+m_ircv3_capnotify: modules/m_ircv3_capnotify.so
+modules/m_ircv3_capnotify.so: modules/m_ircv3_capnotify.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/cap.h include/modules/reload.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_ircv3_capnotify.cpp $>
+.PHONY: m_ircv3_chghost
+m_ircv3_chghost: modules/m_ircv3_chghost.so
+modules/m_ircv3_chghost.so: modules/m_ircv3_chghost.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/cap.h include/modules/ircv3.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_ircv3_chghost.cpp $>
+.PHONY: m_ircv3_ctctags
+m_ircv3_ctctags: modules/m_ircv3_ctctags.so
+modules/m_ircv3_ctctags.so: modules/m_ircv3_ctctags.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/cap.h include/modules/ctctags.h include/modules/isupport.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_ircv3_ctctags.cpp $>
+.PHONY: m_ircv3_echomessage
+m_ircv3_echomessage: modules/m_ircv3_echomessage.so
+modules/m_ircv3_echomessage.so: modules/m_ircv3_echomessage.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/cap.h include/modules/ctctags.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_ircv3_echomessage.cpp $>
+.PHONY: m_ircv3_invitenotify
+m_ircv3_invitenotify: modules/m_ircv3_invitenotify.so
+modules/m_ircv3_invitenotify.so: modules/m_ircv3_invitenotify.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/cap.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_ircv3_invitenotify.cpp $>
+.PHONY: m_ircv3_labeledresponse
+m_ircv3_labeledresponse: modules/m_ircv3_labeledresponse.so
+modules/m_ircv3_labeledresponse.so: modules/m_ircv3_labeledresponse.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/cap.h include/modules/ircv3_batch.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_ircv3_labeledresponse.cpp $>
+.PHONY: m_ircv3_msgid
+m_ircv3_msgid: modules/m_ircv3_msgid.so
+modules/m_ircv3_msgid.so: modules/m_ircv3_msgid.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/cap.h include/modules/ctctags.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_ircv3_msgid.cpp $>
+.PHONY: m_ircv3_servertime
+m_ircv3_servertime: modules/m_ircv3_servertime.so
+modules/m_ircv3_servertime.so: modules/m_ircv3_servertime.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/cap.h include/modules/ircv3.h include/modules/ircv3_servertime.h include/modules/server.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_ircv3_servertime.cpp $>
+.PHONY: m_ircv3_sts
+m_ircv3_sts: modules/m_ircv3_sts.so
+modules/m_ircv3_sts.so: modules/m_ircv3_sts.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/cap.h include/modules/ssl.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_ircv3_sts.cpp $>
+.PHONY: m_joinflood
+m_joinflood: modules/m_joinflood.so
+modules/m_joinflood.so: modules/m_joinflood.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/server.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_joinflood.cpp $>
+.PHONY: m_kicknorejoin
+m_kicknorejoin: modules/m_kicknorejoin.so
+modules/m_kicknorejoin.so: modules/m_kicknorejoin.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/invite.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_kicknorejoin.cpp $>
+.PHONY: m_knock
+m_knock: modules/m_knock.so
+modules/m_knock.so: modules/m_knock.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_knock.cpp $>
+.PHONY: m_ldapauth
+m_ldapauth: modules/m_ldapauth.so
+modules/m_ldapauth.so: modules/m_ldapauth.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/ldap.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_ldapauth.cpp $>
+.PHONY: m_ldapoper
+m_ldapoper: modules/m_ldapoper.so
+modules/m_ldapoper.so: modules/m_ldapoper.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/ldap.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_ldapoper.cpp $>
+.PHONY: m_lockserv
+m_lockserv: modules/m_lockserv.so
+modules/m_lockserv.so: modules/m_lockserv.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_lockserv.cpp $>
+.PHONY: m_maphide
+m_maphide: modules/m_maphide.so
+modules/m_maphide.so: modules/m_maphide.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_maphide.cpp $>
+.PHONY: m_md5
+m_md5: modules/m_md5.so
+modules/m_md5.so: modules/m_md5.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/hash.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_md5.cpp $>
+.PHONY: m_messageflood
+m_messageflood: modules/m_messageflood.so
+modules/m_messageflood.so: modules/m_messageflood.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/cap.h include/modules/ctctags.h include/modules/exemption.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_messageflood.cpp $>
+.PHONY: m_mlock
+m_mlock: modules/m_mlock.so
+modules/m_mlock.so: modules/m_mlock.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_mlock.cpp $>
+.PHONY: m_monitor
+m_monitor: modules/m_monitor.so
+modules/m_monitor.so: modules/m_monitor.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/isupport.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_monitor.cpp $>
+.PHONY: m_muteban
+m_muteban: modules/m_muteban.so
+modules/m_muteban.so: modules/m_muteban.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/cap.h include/modules/ctctags.h include/modules/extban.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_muteban.cpp $>
+.PHONY: m_namedmodes
+m_namedmodes: modules/m_namedmodes.so
+modules/m_namedmodes.so: modules/m_namedmodes.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_namedmodes.cpp $>
+.PHONY: m_namesx
+m_namesx: modules/m_namesx.so
+modules/m_namesx.so: modules/m_namesx.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/cap.h include/modules/isupport.h include/modules/names.h include/modules/who.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_namesx.cpp $>
+.PHONY: m_nationalchars
+m_nationalchars: modules/m_nationalchars.so
+modules/m_nationalchars.so: modules/m_nationalchars.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_nationalchars.cpp $>
+.PHONY: m_nickflood
+m_nickflood: modules/m_nickflood.so
+modules/m_nickflood.so: modules/m_nickflood.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/exemption.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_nickflood.cpp $>
+.PHONY: m_nicklock
+m_nicklock: modules/m_nicklock.so
+modules/m_nicklock.so: modules/m_nicklock.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_nicklock.cpp $>
+.PHONY: m_noctcp
+m_noctcp: modules/m_noctcp.so
+modules/m_noctcp.so: modules/m_noctcp.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/exemption.h include/modules/extban.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_noctcp.cpp $>
+.PHONY: m_nokicks
+m_nokicks: modules/m_nokicks.so
+modules/m_nokicks.so: modules/m_nokicks.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/extban.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_nokicks.cpp $>
+.PHONY: m_nonicks
+m_nonicks: modules/m_nonicks.so
+modules/m_nonicks.so: modules/m_nonicks.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/exemption.h include/modules/extban.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_nonicks.cpp $>
+.PHONY: m_nonotice
+m_nonotice: modules/m_nonotice.so
+modules/m_nonotice.so: modules/m_nonotice.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/exemption.h include/modules/extban.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_nonotice.cpp $>
+.PHONY: m_nopartmsg
+m_nopartmsg: modules/m_nopartmsg.so
+modules/m_nopartmsg.so: modules/m_nopartmsg.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/extban.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_nopartmsg.cpp $>
+.PHONY: m_ojoin
+m_ojoin: modules/m_ojoin.so
+modules/m_ojoin.so: modules/m_ojoin.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_ojoin.cpp $>
+.PHONY: m_operchans
+m_operchans: modules/m_operchans.so
+modules/m_operchans.so: modules/m_operchans.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/extban.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_operchans.cpp $>
+.PHONY: m_operjoin
+m_operjoin: modules/m_operjoin.so
+modules/m_operjoin.so: modules/m_operjoin.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_operjoin.cpp $>
+.PHONY: m_operlevels
+m_operlevels: modules/m_operlevels.so
+modules/m_operlevels.so: modules/m_operlevels.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_operlevels.cpp $>
+.PHONY: m_operlog
+m_operlog: modules/m_operlog.so
+modules/m_operlog.so: modules/m_operlog.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/isupport.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_operlog.cpp $>
+.PHONY: m_opermodes
+m_opermodes: modules/m_opermodes.so
+modules/m_opermodes.so: modules/m_opermodes.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_opermodes.cpp $>
+.PHONY: m_opermotd
+m_opermotd: modules/m_opermotd.so
+modules/m_opermotd.so: modules/m_opermotd.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_opermotd.cpp $>
+.PHONY: m_operprefix
+m_operprefix: modules/m_operprefix.so
+modules/m_operprefix.so: modules/m_operprefix.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_operprefix.cpp $>
+.PHONY: m_override
+m_override: modules/m_override.so
+modules/m_override.so: modules/m_override.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/invite.h include/modules/isupport.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_override.cpp $>
+.PHONY: m_passforward
+m_passforward: modules/m_passforward.so
+modules/m_passforward.so: modules/m_passforward.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/account.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_passforward.cpp $>
+.PHONY: m_password_hash
+m_password_hash: modules/m_password_hash.so
+modules/m_password_hash.so: modules/m_password_hash.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/hash.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_password_hash.cpp $>
+.PHONY: m_pbkdf2
+m_pbkdf2: modules/m_pbkdf2.so
+modules/m_pbkdf2.so: modules/m_pbkdf2.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/hash.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_pbkdf2.cpp $>
+.PHONY: m_permchannels
+m_permchannels: modules/m_permchannels.so
+modules/m_permchannels.so: modules/m_permchannels.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_permchannels.cpp $>
+.PHONY: m_randquote
+m_randquote: modules/m_randquote.so
+modules/m_randquote.so: modules/m_randquote.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_randquote.cpp $>
+.PHONY: m_redirect
+m_redirect: modules/m_redirect.so
+modules/m_redirect.so: modules/m_redirect.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_redirect.cpp $>
+.PHONY: m_regex_glob
+m_regex_glob: modules/m_regex_glob.so
+modules/m_regex_glob.so: modules/m_regex_glob.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/regex.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_regex_glob.cpp $>
+.PHONY: m_regex_stdlib
+m_regex_stdlib: modules/m_regex_stdlib.so
+modules/m_regex_stdlib.so: modules/m_regex_stdlib.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/regex.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_regex_stdlib.cpp $>
+.PHONY: m_remove
+m_remove: modules/m_remove.so
+modules/m_remove.so: modules/m_remove.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/isupport.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_remove.cpp $>
+.PHONY: m_repeat
+m_repeat: modules/m_repeat.so
+modules/m_repeat.so: modules/m_repeat.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/exemption.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_repeat.cpp $>
+.PHONY: m_restrictchans
+m_restrictchans: modules/m_restrictchans.so
+modules/m_restrictchans.so: modules/m_restrictchans.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/account.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_restrictchans.cpp $>
+.PHONY: m_restrictmsg
+m_restrictmsg: modules/m_restrictmsg.so
+modules/m_restrictmsg.so: modules/m_restrictmsg.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/cap.h include/modules/ctctags.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_restrictmsg.cpp $>
+.PHONY: m_rline
+m_rline: modules/m_rline.so
+modules/m_rline.so: modules/m_rline.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/regex.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_rline.cpp $>
+.PHONY: m_rmode
+m_rmode: modules/m_rmode.so
+modules/m_rmode.so: modules/m_rmode.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_rmode.cpp $>
+.PHONY: m_sajoin
+m_sajoin: modules/m_sajoin.so
+modules/m_sajoin.so: modules/m_sajoin.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_sajoin.cpp $>
+.PHONY: m_sakick
+m_sakick: modules/m_sakick.so
+modules/m_sakick.so: modules/m_sakick.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_sakick.cpp $>
+.PHONY: m_samode
+m_samode: modules/m_samode.so
+modules/m_samode.so: modules/m_samode.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_samode.cpp $>
+.PHONY: m_sanick
+m_sanick: modules/m_sanick.so
+modules/m_sanick.so: modules/m_sanick.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_sanick.cpp $>
+.PHONY: m_sapart
+m_sapart: modules/m_sapart.so
+modules/m_sapart.so: modules/m_sapart.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_sapart.cpp $>
+.PHONY: m_saquit
+m_saquit: modules/m_saquit.so
+modules/m_saquit.so: modules/m_saquit.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_saquit.cpp $>
+.PHONY: m_sasl
+m_sasl: modules/m_sasl.so
+modules/m_sasl.so: modules/m_sasl.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/account.h include/modules/cap.h include/modules/sasl.h include/modules/server.h include/modules/ssl.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_sasl.cpp $>
+.PHONY: m_satopic
+m_satopic: modules/m_satopic.so
+modules/m_satopic.so: modules/m_satopic.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_satopic.cpp $>
+.PHONY: m_securelist
+m_securelist: modules/m_securelist.so
+modules/m_securelist.so: modules/m_securelist.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/account.h include/modules/isupport.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_securelist.cpp $>
+.PHONY: m_seenicks
+m_seenicks: modules/m_seenicks.so
+modules/m_seenicks.so: modules/m_seenicks.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_seenicks.cpp $>
+.PHONY: m_serverban
+m_serverban: modules/m_serverban.so
+modules/m_serverban.so: modules/m_serverban.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/extban.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_serverban.cpp $>
+.PHONY: m_services_account
+m_services_account: modules/m_services_account.so
+modules/m_services_account.so: modules/m_services_account.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/account.h include/modules/callerid.h include/modules/cap.h include/modules/ctctags.h include/modules/exemption.h include/modules/extban.h include/modules/whois.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_services_account.cpp $>
+.PHONY: m_servprotect
+m_servprotect: modules/m_servprotect.so
+modules/m_servprotect.so: modules/m_servprotect.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/whois.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_servprotect.cpp $>
+.PHONY: m_sethost
+m_sethost: modules/m_sethost.so
+modules/m_sethost.so: modules/m_sethost.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_sethost.cpp $>
+.PHONY: m_setident
+m_setident: modules/m_setident.so
+modules/m_setident.so: modules/m_setident.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_setident.cpp $>
+.PHONY: m_setidle
+m_setidle: modules/m_setidle.so
+modules/m_setidle.so: modules/m_setidle.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_setidle.cpp $>
+.PHONY: m_setname
+m_setname: modules/m_setname.so
+modules/m_setname.so: modules/m_setname.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/cap.h include/modules/ircv3.h include/modules/ircv3_replies.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_setname.cpp $>
+.PHONY: m_sha1
+m_sha1: modules/m_sha1.so
+modules/m_sha1.so: modules/m_sha1.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/hash.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_sha1.cpp $>
+.PHONY: m_sha256
+m_sha256: modules/m_sha256.so
+modules/m_sha256.so: modules/m_sha256.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/hash.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_sha256.cpp $>
+.PHONY: m_showfile
+m_showfile: modules/m_showfile.so
+modules/m_showfile.so: modules/m_showfile.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_showfile.cpp $>
+.PHONY: m_showwhois
+m_showwhois: modules/m_showwhois.so
+modules/m_showwhois.so: modules/m_showwhois.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/whois.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_showwhois.cpp $>
+.PHONY: m_shun
+m_shun: modules/m_shun.so
+modules/m_shun.so: modules/m_shun.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/shun.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_shun.cpp $>
+.PHONY: m_silence
+m_silence: modules/m_silence.so
+modules/m_silence.so: modules/m_silence.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/cap.h include/modules/ctctags.h include/modules/isupport.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_silence.cpp $>
+obj/m_spanningtree/addline.o: modules/m_spanningtree/addline.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/xline.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/addline.cpp $>
+obj/m_spanningtree/away.o: modules/m_spanningtree/away.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/modules/cap.h include/modules/ctctags.h include/modules/dns.h include/modules/server.h include/modules/ssl.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/tags.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/away.cpp $>
+obj/m_spanningtree/capab.o: modules/m_spanningtree/capab.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/modules/cap.h include/modules/ctctags.h include/modules/dns.h include/modules/extban.h include/modules/server.h include/modules/ssl.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/link.h modules/m_spanningtree/main.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/tags.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/capab.cpp $>
+obj/m_spanningtree/delline.o: modules/m_spanningtree/delline.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/xline.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/delline.cpp $>
+obj/m_spanningtree/encap.o: modules/m_spanningtree/encap.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/modules/cap.h include/modules/ctctags.h include/modules/dns.h include/modules/server.h include/modules/ssl.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/tags.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/encap.cpp $>
+obj/m_spanningtree/fjoin.o: modules/m_spanningtree/fjoin.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/fjoin.cpp $>
+obj/m_spanningtree/fmode.o: modules/m_spanningtree/fmode.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/fmode.cpp $>
+obj/m_spanningtree/ftopic.o: modules/m_spanningtree/ftopic.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/ftopic.cpp $>
+obj/m_spanningtree/hmac.o: modules/m_spanningtree/hmac.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/modules/cap.h include/modules/ctctags.h include/modules/dns.h include/modules/hash.h include/modules/server.h include/modules/ssl.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/link.h modules/m_spanningtree/main.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/tags.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/hmac.cpp $>
+obj/m_spanningtree/idle.o: modules/m_spanningtree/idle.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/idle.cpp $>
+obj/m_spanningtree/ijoin.o: modules/m_spanningtree/ijoin.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/ijoin.cpp $>
+obj/m_spanningtree/main.o: modules/m_spanningtree/main.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/modules/cap.h include/modules/ctctags.h include/modules/dns.h include/modules/server.h include/modules/ssl.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/xline.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/link.h modules/m_spanningtree/main.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/resolvers.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/tags.h modules/m_spanningtree/translate.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/main.cpp $>
+obj/m_spanningtree/metadata.o: modules/m_spanningtree/metadata.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/metadata.cpp $>
+obj/m_spanningtree/misccommands.o: modules/m_spanningtree/misccommands.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/modules/cap.h include/modules/ctctags.h include/modules/dns.h include/modules/server.h include/modules/ssl.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/tags.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/misccommands.cpp $>
+obj/m_spanningtree/netburst.o: modules/m_spanningtree/netburst.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/modules/cap.h include/modules/ctctags.h include/modules/dns.h include/modules/server.h include/modules/ssl.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/xline.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/tags.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/netburst.cpp $>
+obj/m_spanningtree/nick.o: modules/m_spanningtree/nick.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/modules/cap.h include/modules/ctctags.h include/modules/dns.h include/modules/server.h include/modules/ssl.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/tags.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/nick.cpp $>
+obj/m_spanningtree/nickcollide.o: modules/m_spanningtree/nickcollide.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/nickcollide.cpp $>
+obj/m_spanningtree/num.o: modules/m_spanningtree/num.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/num.cpp $>
+obj/m_spanningtree/opertype.o: modules/m_spanningtree/opertype.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/opertype.cpp $>
+obj/m_spanningtree/override_map.o: modules/m_spanningtree/override_map.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/modules/cap.h include/modules/ctctags.h include/modules/dns.h include/modules/server.h include/modules/ssl.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/tags.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/override_map.cpp $>
+obj/m_spanningtree/override_squit.o: modules/m_spanningtree/override_squit.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/modules/cap.h include/modules/ctctags.h include/modules/dns.h include/modules/server.h include/modules/ssl.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/tags.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/override_squit.cpp $>
+obj/m_spanningtree/override_stats.o: modules/m_spanningtree/override_stats.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/modules/cap.h include/modules/ctctags.h include/modules/dns.h include/modules/server.h include/modules/ssl.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/link.h modules/m_spanningtree/main.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/tags.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/override_stats.cpp $>
+obj/m_spanningtree/override_whois.o: modules/m_spanningtree/override_whois.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/modules/cap.h include/modules/ctctags.h include/modules/dns.h include/modules/server.h include/modules/ssl.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/tags.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/override_whois.cpp $>
+obj/m_spanningtree/ping.o: modules/m_spanningtree/ping.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/ping.cpp $>
+obj/m_spanningtree/pingtimer.o: modules/m_spanningtree/pingtimer.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/modules/cap.h include/modules/ctctags.h include/modules/dns.h include/modules/server.h include/modules/ssl.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/tags.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/pingtimer.cpp $>
+obj/m_spanningtree/pong.o: modules/m_spanningtree/pong.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/pong.cpp $>
+obj/m_spanningtree/postcommand.o: modules/m_spanningtree/postcommand.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/modules/cap.h include/modules/ctctags.h include/modules/dns.h include/modules/server.h include/modules/ssl.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/tags.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/postcommand.cpp $>
+obj/m_spanningtree/precommand.o: modules/m_spanningtree/precommand.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/modules/cap.h include/modules/ctctags.h include/modules/dns.h include/modules/server.h include/modules/ssl.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/tags.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/precommand.cpp $>
+obj/m_spanningtree/protocolinterface.o: modules/m_spanningtree/protocolinterface.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/protocolinterface.cpp $>
+obj/m_spanningtree/rconnect.o: modules/m_spanningtree/rconnect.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/modules/cap.h include/modules/ctctags.h include/modules/dns.h include/modules/server.h include/modules/ssl.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/tags.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/rconnect.cpp $>
+obj/m_spanningtree/remoteuser.o: modules/m_spanningtree/remoteuser.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/modules/cap.h include/modules/ctctags.h include/modules/dns.h include/modules/server.h include/modules/ssl.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/tags.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/remoteuser.cpp $>
+obj/m_spanningtree/resolvers.o: modules/m_spanningtree/resolvers.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/modules/cap.h include/modules/ctctags.h include/modules/dns.h include/modules/server.h include/modules/ssl.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/link.h modules/m_spanningtree/main.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/resolvers.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/tags.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/resolvers.cpp $>
+obj/m_spanningtree/rsquit.o: modules/m_spanningtree/rsquit.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/modules/cap.h include/modules/ctctags.h include/modules/dns.h include/modules/server.h include/modules/ssl.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/tags.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/rsquit.cpp $>
+obj/m_spanningtree/save.o: modules/m_spanningtree/save.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/save.cpp $>
+obj/m_spanningtree/server.o: modules/m_spanningtree/server.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/modules/cap.h include/modules/ctctags.h include/modules/dns.h include/modules/server.h include/modules/ssl.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/link.h modules/m_spanningtree/main.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/tags.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/server.cpp $>
+obj/m_spanningtree/servercommand.o: modules/m_spanningtree/servercommand.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/modules/cap.h include/modules/ctctags.h include/modules/dns.h include/modules/server.h include/modules/ssl.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/tags.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/servercommand.cpp $>
+obj/m_spanningtree/sinfo.o: modules/m_spanningtree/sinfo.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/sinfo.cpp $>
+obj/m_spanningtree/svsjoin.o: modules/m_spanningtree/svsjoin.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/svsjoin.cpp $>
+obj/m_spanningtree/svsnick.o: modules/m_spanningtree/svsnick.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/modules/cap.h include/modules/ctctags.h include/modules/dns.h include/modules/server.h include/modules/ssl.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/tags.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/svsnick.cpp $>
+obj/m_spanningtree/svspart.o: modules/m_spanningtree/svspart.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/svspart.cpp $>
+obj/m_spanningtree/tags.o: modules/m_spanningtree/tags.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/modules/cap.h include/modules/ctctags.h include/modules/dns.h include/modules/server.h include/modules/ssl.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/tags.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/tags.cpp $>
+obj/m_spanningtree/translate.o: modules/m_spanningtree/translate.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/translate.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/translate.cpp $>
+obj/m_spanningtree/treeserver.o: modules/m_spanningtree/treeserver.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/modules/cap.h include/modules/ctctags.h include/modules/dns.h include/modules/server.h include/modules/ssl.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/xline.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/tags.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/treeserver.cpp $>
+obj/m_spanningtree/treesocket1.o: modules/m_spanningtree/treesocket1.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/modules/cap.h include/modules/ctctags.h include/modules/dns.h include/modules/server.h include/modules/ssl.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/link.h modules/m_spanningtree/main.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/tags.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/treesocket1.cpp $>
+obj/m_spanningtree/treesocket2.o: modules/m_spanningtree/treesocket2.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/modules/cap.h include/modules/ctctags.h include/modules/dns.h include/modules/server.h include/modules/ssl.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/link.h modules/m_spanningtree/main.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/resolvers.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/tags.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/treesocket2.cpp $>
+obj/m_spanningtree/uid.o: modules/m_spanningtree/uid.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/uid.cpp $>
+obj/m_spanningtree/utils.o: modules/m_spanningtree/utils.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/modules/cap.h include/modules/ctctags.h include/modules/dns.h include/modules/server.h include/modules/ssl.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/link.h modules/m_spanningtree/main.h modules/m_spanningtree/pingtimer.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/remoteuser.h modules/m_spanningtree/resolvers.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/tags.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o $@ $(SOURCEPATH)/src/modules/m_spanningtree/utils.cpp $>
+.PHONY: m_spanningtree
+m_spanningtree: modules/m_spanningtree.so
+modules/m_spanningtree.so: obj/m_spanningtree/addline.o obj/m_spanningtree/away.o obj/m_spanningtree/capab.o obj/m_spanningtree/delline.o obj/m_spanningtree/encap.o obj/m_spanningtree/fjoin.o obj/m_spanningtree/fmode.o obj/m_spanningtree/ftopic.o obj/m_spanningtree/hmac.o obj/m_spanningtree/idle.o obj/m_spanningtree/ijoin.o obj/m_spanningtree/main.o obj/m_spanningtree/metadata.o obj/m_spanningtree/misccommands.o obj/m_spanningtree/netburst.o obj/m_spanningtree/nick.o obj/m_spanningtree/nickcollide.o obj/m_spanningtree/num.o obj/m_spanningtree/opertype.o obj/m_spanningtree/override_map.o obj/m_spanningtree/override_squit.o obj/m_spanningtree/override_stats.o obj/m_spanningtree/override_whois.o obj/m_spanningtree/ping.o obj/m_spanningtree/pingtimer.o obj/m_spanningtree/pong.o obj/m_spanningtree/postcommand.o obj/m_spanningtree/precommand.o obj/m_spanningtree/protocolinterface.o obj/m_spanningtree/rconnect.o obj/m_spanningtree/remoteuser.o obj/m_spanningtree/resolvers.o obj/m_spanningtree/rsquit.o obj/m_spanningtree/save.o obj/m_spanningtree/server.o obj/m_spanningtree/servercommand.o obj/m_spanningtree/sinfo.o obj/m_spanningtree/svsjoin.o obj/m_spanningtree/svsnick.o obj/m_spanningtree/svspart.o obj/m_spanningtree/tags.o obj/m_spanningtree/translate.o obj/m_spanningtree/treeserver.o obj/m_spanningtree/treesocket1.o obj/m_spanningtree/treesocket2.o obj/m_spanningtree/uid.o obj/m_spanningtree/utils.o
+	@$(SOURCEPATH)/make/unit-cc.pl link-dir $@ /root/repo/src/modules/m_spanningtree $^ $>
+.PHONY: m_sqlauth
+m_sqlauth: modules/m_sqlauth.so
+modules/m_sqlauth.so: modules/m_sqlauth.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/hash.h include/modules/sql.h include/modules/ssl.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_sqlauth.cpp $>
+.PHONY: m_sqloper
+m_sqloper: modules/m_sqloper.so
+modules/m_sqloper.so: modules/m_sqloper.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/sql.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_sqloper.cpp $>
+.PHONY: m_sslinfo
+m_sslinfo: modules/m_sslinfo.so
+modules/m_sslinfo.so: modules/m_sslinfo.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/ssl.h include/modules/webirc.h include/modules/who.h include/modules/whois.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_sslinfo.cpp $>
+.PHONY: m_sslmodes
+m_sslmodes: modules/m_sslmodes.so
+modules/m_sslmodes.so: modules/m_sslmodes.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/cap.h include/modules/ctctags.h include/modules/extban.h include/modules/ssl.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_sslmodes.cpp $>
+.PHONY: m_starttls
+m_starttls: modules/m_starttls.so
+modules/m_starttls.so: modules/m_starttls.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/cap.h include/modules/ssl.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_starttls.cpp $>
+.PHONY: m_stripcolor
+m_stripcolor: modules/m_stripcolor.so
+modules/m_stripcolor.so: modules/m_stripcolor.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/exemption.h include/modules/extban.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_stripcolor.cpp $>
+.PHONY: m_svshold
+m_svshold: modules/m_svshold.so
+modules/m_svshold.so: modules/m_svshold.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/stats.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_svshold.cpp $>
+.PHONY: m_swhois
+m_swhois: modules/m_swhois.so
+modules/m_swhois.so: modules/m_swhois.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/whois.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_swhois.cpp $>
+.PHONY: m_timedbans
+m_timedbans: modules/m_timedbans.so
+modules/m_timedbans.so: modules/m_timedbans.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/listmode.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_timedbans.cpp $>
+.PHONY: m_tline
+m_tline: modules/m_tline.so
+modules/m_tline.so: modules/m_tline.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_tline.cpp $>
+.PHONY: m_topiclock
+m_topiclock: modules/m_topiclock.so
+modules/m_topiclock.so: modules/m_topiclock.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_topiclock.cpp $>
+.PHONY: m_trafficcapture
+m_trafficcapture: modules/m_trafficcapture.so
+modules/m_trafficcapture.so: modules/m_trafficcapture.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_trafficcapture.cpp $>
+.PHONY: m_uhnames
+m_uhnames: modules/m_uhnames.so
+modules/m_uhnames.so: modules/m_uhnames.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/cap.h include/modules/isupport.h include/modules/names.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_uhnames.cpp $>
+.PHONY: m_uninvite
+m_uninvite: modules/m_uninvite.so
+modules/m_uninvite.so: modules/m_uninvite.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/invite.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_uninvite.cpp $>
+.PHONY: m_userip
+m_userip: modules/m_userip.so
+modules/m_userip.so: modules/m_userip.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/isupport.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_userip.cpp $>
+.PHONY: m_vhost
+m_vhost: modules/m_vhost.so
+modules/m_vhost.so: modules/m_vhost.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_vhost.cpp $>
+.PHONY: m_watch
+m_watch: modules/m_watch.so
+modules/m_watch.so: modules/m_watch.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/away.h include/modules/isupport.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h modules/m_monitor.cpp
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_watch.cpp $>
+.PHONY: m_websocket
+m_websocket: modules/m_websocket.so
+modules/m_websocket.so: modules/m_websocket.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/modules/hash.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_websocket.cpp $>
+.PHONY: m_xline_db
+m_xline_db: modules/m_xline_db.so
+modules/m_xline_db.so: modules/m_xline_db.cpp include/aligned_storage.h include/bancache.h include/base.h include/channels.h include/clientprotocol.h include/clientprotocolevent.h include/clientprotocolmsg.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/convto.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/event.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iterator_range.h include/logger.h include/membership.h include/message.h include/mode.h include/modechange.h include/moduledefs.h include/modules.h include/numeric.h include/numericbuilder.h include/numerics.h include/parammode.h include/protocol.h include/serialize.h include/server.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/thread.h include/threadsocket.h include/timer.h include/token_list.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so $@ $(SOURCEPATH)/src/modules/m_xline_db.cpp $>
+
+bin/inspircd: obj/bancache.o obj/base.o obj/channels.o obj/cidr.o obj/clientprotocol.o obj/command_parse.o obj/commands.o obj/configparser.o obj/configreader.o obj/cull_list.o obj/dynamic.o obj/extensible.o obj/filelogger.o obj/fileutils.o obj/hashcomp.o obj/helperfuncs.o obj/inspircd.o obj/inspsocket.o obj/inspstring.o obj/listensocket.o obj/listmode.o obj/logger.o obj/mode.o obj/modulemanager.o obj/modules.o obj/serializable.o obj/server.o obj/snomasks.o obj/socket.o obj/socketengine.o obj/thread.o obj/threadsocket.o obj/timer.o obj/usermanager.o obj/users.o obj/wildcard.o obj/xline.o obj/socketengine_epoll.o
+	@$(SOURCEPATH)/make/unit-cc.pl core-ld $@ $^ $>
+
+inspircd: bin/inspircd
+
+bin/inspircd-bench: obj/bench/primitives.o obj/bancache.o obj/base.o obj/channels.o obj/cidr.o obj/clientprotocol.o obj/command_parse.o obj/commands.o obj/configparser.o obj/configreader.o obj/cull_list.o obj/dynamic.o obj/extensible.o obj/filelogger.o obj/fileutils.o obj/hashcomp.o obj/helperfuncs.o obj/inspsocket.o obj/inspstring.o obj/listensocket.o obj/listmode.o obj/logger.o obj/mode.o obj/modulemanager.o obj/modules.o obj/serializable.o obj/server.o obj/snomasks.o obj/socket.o obj/socketengine.o obj/thread.o obj/threadsocket.o obj/timer.o obj/usermanager.o obj/users.o obj/wildcard.o obj/xline.o obj/socketengine_epoll.o
+	@$(SOURCEPATH)/make/unit-cc.pl core-ld $@ $^ $>
+
+inspircd-bench: bin/inspircd-bench
+
+modules: modules/core_channel.so modules/core_dns.so modules/core_hostname_lookup.so modules/core_info.so modules/core_list.so modules/core_loadmodule.so modules/core_lusers.so modules/core_message.so modules/core_mode.so modules/core_oper.so modules/core_reloadmodule.so modules/core_serialize_rfc.so modules/core_stats.so modules/core_stub.so modules/core_user.so modules/core_wallops.so modules/core_who.so modules/core_whois.so modules/core_whowas.so modules/core_xline.so modules/m_abbreviation.so modules/m_alias.so modules/m_allowinvite.so modules/m_alltime.so modules/m_anticaps.so modules/m_auditorium.so modules/m_autoop.so modules/m_banexception.so modules/m_banredirect.so modules/m_bcrypt.so modules/m_blockamsg.so modules/m_blockcolor.so modules/m_botmode.so modules/m_callerid.so modules/m_cap.so modules/m_cban.so modules/m_censor.so modules/m_cgiirc.so modules/m_chancreate.so modules/m_chanfilter.so modules/m_chanhistory.so modules/m_chanlog.so modules/m_channames.so modules/m_channelban.so modules/m_check.so modules/m_chghost.so modules/m_chgident.so modules/m_chgname.so modules/m_classban.so modules/m_clearchan.so modules/m_cloaking.so modules/m_clones.so modules/m_codepage.so modules/m_commonchans.so modules/m_conn_join.so modules/m_conn_umodes.so modules/m_conn_waitpong.so modules/m_connectban.so modules/m_connflood.so modules/m_customprefix.so modules/m_customtitle.so modules/m_cycle.so modules/m_dccallow.so modules/m_deaf.so modules/m_delayjoin.so modules/m_delaymsg.so modules/m_denychans.so modules/m_disable.so modules/m_dnsbl.so modules/m_exemptchanops.so modules/m_filter.so modules/m_gecosban.so modules/m_geoban.so modules/m_geoclass.so modules/m_globalload.so modules/m_globops.so modules/m_haproxy.so modules/m_helpop.so modules/m_hidechans.so modules/m_hidelist.so modules/m_hidemode.so modules/m_hideoper.so modules/m_hostchange.so modules/m_hostcycle.so modules/m_httpd.so modules/m_httpd_acl.so modules/m_httpd_config.so modules/m_httpd_stats.so modules/m_ident.so modules/m_inviteexception.so modules/m_ircv3.so modules/m_ircv3_accounttag.so modules/m_ircv3_batch.so modules/m_ircv3_capnotify.so modules/m_ircv3_chghost.so modules/m_ircv3_ctctags.so modules/m_ircv3_echomessage.so modules/m_ircv3_invitenotify.so modules/m_ircv3_labeledresponse.so modules/m_ircv3_msgid.so modules/m_ircv3_servertime.so modules/m_ircv3_sts.so modules/m_joinflood.so modules/m_kicknorejoin.so modules/m_knock.so modules/m_ldapauth.so modules/m_ldapoper.so modules/m_lockserv.so modules/m_maphide.so modules/m_md5.so modules/m_messageflood.so modules/m_mlock.so modules/m_monitor.so modules/m_muteban.so modules/m_namedmodes.so modules/m_namesx.so modules/m_nationalchars.so modules/m_nickflood.so modules/m_nicklock.so modules/m_noctcp.so modules/m_nokicks.so modules/m_nonicks.so modules/m_nonotice.so modules/m_nopartmsg.so modules/m_ojoin.so modules/m_operchans.so modules/m_operjoin.so modules/m_operlevels.so modules/m_operlog.so modules/m_opermodes.so modules/m_opermotd.so modules/m_operprefix.so modules/m_override.so modules/m_passforward.so modules/m_password_hash.so modules/m_pbkdf2.so modules/m_permchannels.so modules/m_randquote.so modules/m_redirect.so modules/m_regex_glob.so modules/m_regex_stdlib.so modules/m_remove.so modules/m_repeat.so modules/m_restrictchans.so modules/m_restrictmsg.so modules/m_rline.so modules/m_rmode.so modules/m_sajoin.so modules/m_sakick.so modules/m_samode.so modules/m_sanick.so modules/m_sapart.so modules/m_saquit.so modules/m_sasl.so modules/m_satopic.so modules/m_securelist.so modules/m_seenicks.so modules/m_serverban.so modules/m_services_account.so modules/m_servprotect.so modules/m_sethost.so modules/m_setident.so modules/m_setidle.so modules/m_setname.so modules/m_sha1.so modules/m_sha256.so modules/m_showfile.so modules/m_showwhois.so modules/m_shun.so modules/m_silence.so modules/m_spanningtree.so modules/m_sqlauth.so modules/m_sqloper.so modules/m_sslinfo.so modules/m_sslmodes.so modules/m_starttls.so modules/m_stripcolor.so modules/m_svshold.so modules/m_swhois.so modules/m_timedbans.so modules/m_tline.so modules/m_topiclock.so modules/m_trafficcapture.so modules/m_uhnames.so modules/m_uninvite.so modules/m_userip.so modules/m_vhost.so modules/m_watch.so modules/m_websocket.so modules/m_xline_db.so
+
+.PHONY: all bad-target inspircd inspircd-bench modules
+
@@ -44,6 +44,19 @@ class CoreExport Channel : public Extensible
 	 */
  	typedef std::map<User*, insp::aligned_storage<Membership> > MemberMap;
 
+	/** The modes which are set on a channel along with their parameters. */
+	struct ModeList final
+	{
+		/** The letters of the modes which are set. */
+		std::string letters;
+
+		/** The parameters of the modes which are set in the same order as their letters. */
+		std::vector<std::string> params;
+
+		/** The letters followed by each of the parameters with a space before it. */
+		std::string str;
+	};
+
  private:
 	/** Set default modes for the channel on creation
 	 */
@@ -55,6 +68,12 @@ class CoreExport Channel : public Extensible
 	 */
 	std::bitset<ModeParser::MODEID_MAX> modes;
 
+	/** Cached results of GetModeList(), indexed by the value of showsecret. */
+	ModeList modecache[2];
+
+	/** Whether the corresponding entry in modecache is up to date. */
+	bool modecachevalid[2] = { false, false };
+
 	/** Remove the given membership from the channel's internal map of
 	 * memberships and destroy the Membership object.
 	 * This function does not remove the channel from User::chanlist.
@@ -95,6 +114,11 @@ class CoreExport Channel : public Extensible
 	 */
 	MemberMap userlist;
 
+	/** Incremented whenever a member joins or leaves the channel or when the nick, ident, displayed
+	 * host, or prefix modes of a member change. Used for detecting stale cached member lists.
+	 */
+	unsigned long memberserial = 0;
+
 	/** Channel topic.
 	 * If this is an empty string, no channel topic is set.
 	 */
@@ -251,11 +275,26 @@ class CoreExport Channel : public Extensible
 	void Write(ClientProtocol::EventProvider& protoevprov, ClientProtocol::Message& msg, char status = 0, const CUList& except_list = CUList());
 
 	/** Return the channel's modes with parameters.
+	 * The result is cached until the modes of the channel next change.
 	 * @param showsecret If this is set to true, the value of secret parameters
 	 * are shown, otherwise they are replaced with '&lt;name&gt;'.
-	 * @return The channel mode string
+	 * @return The channel mode string. It remains valid until the modes of the channel change.
+	 */
+	const std::string& ChanModes(bool showsecret) { return GetModeList(showsecret).str; }
+
+	/** Return the channel's modes and their parameters as separate fields.
+	 * This is cached along with the result of ChanModes().
+	 * @param showsecret If this is set to true, the value of secret parameters
+	 * are shown, otherwise they are replaced with '&lt;name&gt;'.
+	 * @return The channel modes. They remain valid until the modes of the channel change.
+	 */
+	const ModeList& GetModeList(bool showsecret);
+
+	/** Discards the cached mode strings returned by ChanModes().
+	 * This is done automatically by SetMode(). Modules which change how the parameter of a mode is
+	 * displayed without changing the mode should call this.
 	 */
-	const char* ChanModes(bool showsecret);
+	void InvalidateModeCache() { modecachevalid[0] = modecachevalid[1] = false; }
 
 	/** Get the value of a users prefix on this channel.
 	 * @param user The user to look up
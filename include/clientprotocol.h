@@ -413,7 +413,7 @@ class ClientProtocol::Message : public ClientProtocol::MessageSource
 	 * @param val Tag value. If empty no value will be sent with the tag.
 	 * @param tagdata Tag provider specific data, will be passed to MessageTagProvider::ShouldSendTag(). Optional, defaults to NULL.
 	 */
-	void AddTag(const std::string& tagname, MessageTagProvider* tagprov, const std::string& val, void* tagdata = NULL)
+	void AddTag(const std::string& tagname, MessageTagProvider* tagprov, const TagValue& val, void* tagdata = NULL)
 	{
 		tags.insert(std::make_pair(tagname, MessageTagData(tagprov, val, tagdata)));
 	}
@@ -734,6 +734,22 @@ class CoreExport ClientProtocol::Serializer : public DataProvider
 	 */
 	virtual std::string Serialize(const Message& msg, const TagSelection& tagwl) const = 0;
 
+	/** Serialize a numeric for a user without building a Message for it first.
+	 * This is only called when nothing can modify or add tags to the numeric so the output must be
+	 * identical to what Serialize() would produce for the equivalent Messages::Numeric without tags.
+	 * @param user User to serialize the numeric for.
+	 * @param numeric Numeric to serialize.
+	 * @param out String to write the serialized numeric to. Any existing content is replaced.
+	 * @return True if the numeric was serialized or false if the serializer does not support this in
+	 * which case the caller must fall back to Serialize().
+	 */
+	virtual bool SerializeNumeric(LocalUser* user, const Numeric::Numeric& numeric, std::string& out) const { return false; }
+
+	/** Determines whether any message tag providers are subscribed to this serializer.
+	 * @return True if messages sent using this serializer may have tags added to them; otherwise, false.
+	 */
+	bool HasTagProviders() const { return !evprov.GetSubscribers().empty(); }
+
 	/** Parse a protocol message from wire format.
 	 * @param user Source of the message.
 	 * @param line Raw protocol message.
@@ -743,7 +759,7 @@ class CoreExport ClientProtocol::Serializer : public DataProvider
 	virtual bool Parse(LocalUser* user, const std::string& line, ParseOutput& parseoutput) = 0;
 };
 
-inline ClientProtocol::MessageTagData::MessageTagData(MessageTagProvider* prov, const std::string& val, void* data)
+inline ClientProtocol::MessageTagData::MessageTagData(MessageTagProvider* prov, const TagValue& val, void* data)
 	: tagprov(prov)
 	, value(val)
 	, provdata(data)
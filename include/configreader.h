@@ -409,6 +409,17 @@ class CoreExport ServerConfig
 	/** The number of seconds that the server clock can skip by before server operators are warned. */
 	time_t TimeSkipWarn;
 
+	/** The maximum number of bytes which may be queued for sending to all users combined or 0 for no
+	 * limit. Commands which produce a lot of output are refused at three quarters of this and the
+	 * users with the largest send queues are disconnected when it is exceeded.
+	 */
+	unsigned long SendQBudget;
+
+	/** The number of threads to run expensive module initialization on while starting up or 0 to
+	 * use one per CPU core.
+	 */
+	unsigned long StartupThreads;
+
 	/** True if we're going to hide ban reasons for non-opers (e.g. G-lines,
 	 * K-lines, Z-lines)
 	 */
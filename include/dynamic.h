@@ -40,12 +40,21 @@
  */
 class CoreExport DLLManager : public classbase
 {
+ public:
+	/** A function which creates a new instance of a module. */
+	typedef Module* (*InitFunction)();
+
+	/** A map of module file names to the functions which create them. */
+	typedef std::map<std::string, InitFunction> StaticModuleMap;
+
  private:
 	/** The last error string. */
 	std::string err;
 
 	/** The module library handle. */
-#ifdef _WIN32
+#if defined PURE_STATIC
+	InitFunction lib = nullptr;
+#elif defined _WIN32
 	HMODULE lib = INVALID_HANDLE_VALUE;
 #else
 	void* lib = nullptr;
@@ -88,11 +97,27 @@ class CoreExport DLLManager : public classbase
 	}
 
 	/** Retrieves the module version from the dynamic library. */
+#ifdef PURE_STATIC
+	const char* GetVersion() const { return INSPIRCD_VERSION; }
+#else
 	const char* GetVersion() const { return GetSymbol<const char>(MODULE_STR_VERSION); }
+#endif
 
 	/** Retrieves the last error which occurred or an empty string if no errors have occurred. */
 	const std::string& LastError() const { return err; }
 
 	/** Retrieves the filename of the underlying shared library. */
 	const std::string& LibraryName() const { return libname; }
+
+#ifdef PURE_STATIC
+	/** Retrieves the modules which have been linked into the core binary. */
+	static StaticModuleMap& GetStaticModules();
+
+	/** Registers a module which has been linked into the core binary.
+	 * @param name The file name that the module would have if it was built as a shared library.
+	 * @param init The function which creates a new instance of the module.
+	 * @return Always true. This allows the result to be used to initialize a static variable.
+	 */
+	static bool RegisterStatic(const char* name, InitFunction init);
+#endif
 };
@@ -66,7 +66,7 @@ class Events::ModuleEventProvider
 	/** Get list of objects subscribed to this event
 	 * @return List of subscribed objects
 	 */
-	const SubscriberList& GetSubscribers() const { return prov->subscribers; }
+	const SubscriberList& GetSubscribers() const { return prov ? prov->subscribers : subscribers; }
 
 	/** Subscribes a listener to this event.
 	 * @param subscriber The listener to subscribe.
@@ -197,13 +197,14 @@ inline void Events::ModuleEventProvider::Call(void (Class::*function)(FunArgs...
 	if (!GetModule() || GetModule()->dying)
 		return;
 
-	for (const auto& subscriber : subscribers)
+	for (const auto& subscriber : GetSubscribers())
 	{
 		const Module* mod = subscriber->GetModule();
 		if (!mod || mod->dying)
 			continue;
 
 		Class* klass = static_cast<Class*>(subscriber);
+		Module::UsageTimer timer(mod->hookusage);
 		(klass->*function)(std::forward<FwdArgs>(args)...);
 	}
 }
@@ -215,13 +216,14 @@ inline ModResult Events::ModuleEventProvider::FirstResult(ModResult (Class::*fun
 		return MOD_RES_PASSTHRU;
 
 	ModResult result;
-	for (const auto& subscriber : subscribers)
+	for (const auto& subscriber : GetSubscribers())
 	{
 		const Module* mod = subscriber->GetModule();
 		if (!mod || mod->dying)
 			continue;
 
 		Class* klass = static_cast<Class*>(subscriber);
+		Module::UsageTimer timer(mod->hookusage);
 		result = (klass->*function)(std::forward<FwdArgs>(args)...);
 		if (result != MOD_RES_PASSTHRU)
 			break;
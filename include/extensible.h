@@ -44,6 +44,9 @@ class CoreExport ExtensionItem
 	/** The type of Extensible that this ExtensionItem applies to. */
 	const ExtensibleType type;
 
+	/** The number of Extensibles that this ExtensionItem is currently set on. */
+	size_t count = 0;
+
 	/** Initializes an instance of the ExtensionItem class.
 	 * @param owner The module which created this ExtensionItem.
 	 * @param key The name of the extension item (e.g. ssl_cert).
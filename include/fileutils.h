@@ -47,8 +47,8 @@ class CoreExport FilePosition
 /** Provides an easy method of reading a text file into memory. */
 class CoreExport FileReader
 {
-	/** The lines of text in the file. */
-	std::vector<std::string> lines;
+	/** The lines of text in the file. This is shared with the file cache. */
+	std::shared_ptr<const file_cache> lines;
 
 	/** File size in bytes. */
 	unsigned long totalSize = 0;
@@ -62,17 +62,24 @@ class CoreExport FileReader
 	 */
 	FileReader(const std::string& filename);
 
-	/** Loads a text file from disk.
+	/** Loads a text file from the \<files> cache or from disk.
 	 * @param filename The file to read into memory.
 	 * @throw CoreException The file can not be loaded.
 	 */
 	void Load(const std::string& filename);
 
+	/** Loads a text file from disk. Files are only read again if they have been modified since the
+	 * last time they were loaded so callers can load a file on every rehash without rereading it.
+	 * @param filename The file to read into memory.
+	 * @throw CoreException The file can not be loaded.
+	 */
+	void LoadFromDisk(const std::string& filename);
+
 	/** Retrieves the entire contents of the file cache as a single string. */
 	std::string GetString() const;
 
 	/** Retrieves the entire contents of the file cache as a vector of strings. */
-	const std::vector<std::string>& GetVector() const { return lines; }
+	const std::vector<std::string>& GetVector() const;
 
 	/** Retrieves the total size in bytes of the file. */
 	unsigned long TotalSize() const { return totalSize; }
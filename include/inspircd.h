@@ -45,7 +45,9 @@
 #include <array>
 #include <atomic>
 #include <bitset>
+#include <chrono>
 #include <deque>
+#include <exception>
 #include <functional>
 #include <list>
 #include <memory>
@@ -80,9 +82,9 @@ CoreExport extern InspIRCd* ServerInstance;
 #include "numeric.h"
 #include "uid.h"
 #include "server.h"
+#include "timer.h"
 #include "users.h"
 #include "channels.h"
-#include "timer.h"
 #include "hashcomp.h"
 #include "logger.h"
 #include "usermanager.h"
@@ -117,6 +119,10 @@ class serverstats
 	 */
 	unsigned long Refused = 0;
 
+	/** Number of client connections rejected because of a ban before a user was created for them
+	 */
+	unsigned long Rejected = 0;
+
 	/** Number of unknown commands seen
 	 */
 	unsigned long Unknown = 0;
@@ -153,6 +159,14 @@ class serverstats
 	 */
 	unsigned long Recv = 0;
 
+	/** Number of commands refused because the send queue budget was nearly used up
+	 */
+	unsigned long SendQThrottled = 0;
+
+	/** Number of users disconnected because the send queue budget was exceeded
+	 */
+	unsigned long SendQEvicted = 0;
+
 #ifdef _WIN32
 	/** Cpu usage at last sample
 	*/
@@ -176,6 +190,77 @@ class serverstats
 #endif
 };
 
+/** Records how long each part of starting up the server took so that slow
+ * configuration files, modules, and databases can be identified.
+ */
+class CoreExport StartupProfile final
+{
+ public:
+	/** The clock which parts of the startup are timed with. */
+	typedef std::chrono::steady_clock Clock;
+
+ private:
+	/** A part of starting up the server which has been timed. */
+	struct Step final
+	{
+		/** A human readable description of the step. */
+		std::string name;
+
+		/** How long the step took. */
+		Clock::duration time;
+	};
+
+	/** The time at which the server started up. */
+	const Clock::time_point started = Clock::now();
+
+	/** The top level phases of the startup (e.g. reading the config or initializing modules). */
+	std::vector<Step> phases;
+
+	/** The individual steps within the phases (e.g. initializing a specific module). */
+	std::vector<Step> steps;
+
+	/** Calls the specified function and records how long it took in the specified list. */
+	template <typename Function>
+	static void Time(std::vector<Step>& list, const std::string& name, Function&& func)
+	{
+		const Clock::time_point start = Clock::now();
+		func();
+		list.push_back({ name, Clock::now() - start });
+	}
+
+ public:
+	/** Records how long a top level phase of starting up took.
+	 * @param name A human readable description of the phase.
+	 * @param time How long the phase took.
+	 */
+	void AddPhase(const std::string& name, Clock::duration time) { phases.push_back({ name, time }); }
+
+	/** Records how long an individual step of starting up took.
+	 * @param name A human readable description of the step.
+	 * @param time How long the step took.
+	 */
+	void AddStep(const std::string& name, Clock::duration time) { steps.push_back({ name, time }); }
+
+	/** Calls the specified function and records how long it took as a top level phase.
+	 * @param name A human readable description of the phase.
+	 * @param func The function which performs the phase.
+	 */
+	template <typename Function>
+	void TimePhase(const std::string& name, Function&& func) { Time(phases, name, func); }
+
+	/** Calls the specified function and records how long it took as an individual step.
+	 * @param name A human readable description of the step.
+	 * @param func The function which performs the step.
+	 */
+	template <typename Function>
+	void TimeStep(const std::string& name, Function&& func) { Time(steps, name, func); }
+
+	/** Writes how long the startup took to the log and standard output and then
+	 * frees the recorded times as they are not needed once the server is running.
+	 */
+	void Report();
+};
+
 /** The main class of the irc server.
  * This class contains instances of all the other classes in this software.
  * Amongst other things, it contains a ModeParser, a DNS object, a CommandParser
@@ -256,6 +341,10 @@ class CoreExport InspIRCd
 	 */
 	serverstats stats;
 
+	/** Records how long starting up the server took. This is only filled during startup.
+	 */
+	StartupProfile Startup;
+
 	/**  Server Config class, holds configuration file data
 	 */
 	ServerConfig* Config = nullptr;
@@ -305,6 +394,8 @@ class CoreExport InspIRCd
 	inline time_t Time() { return TIME.tv_sec; }
 	/** The fractional time at the start of this mainloop iteration (nanoseconds) */
 	inline long Time_ns() { return TIME.tv_nsec; }
+	/** The time at the start of this mainloop iteration in milliseconds since the UNIX epoch */
+	inline uint64_t Time_ms() { return uint64_t(TIME.tv_sec) * 1000 + TIME.tv_nsec / 1000000; }
 	/** Update the current time. Don't call this unless you have reason to do so. */
 	void UpdateTime();
 
@@ -89,17 +89,12 @@ class CoreExport SocketTimeout : public Timer
 	int sfd;
 
  public:
-	/** Create a socket timeout class
+	/** Create a socket timeout class. The timeout is owned by the module which owns the socket.
 	 * @param fd File descriptor of BufferedSocket
 	 * @param thesock BufferedSocket to attach to
 	 * @param secs_from_now Seconds from now to time out
 	 */
-	SocketTimeout(int fd, BufferedSocket* thesock, unsigned int secs_from_now)
-		: Timer(secs_from_now)
-		, sock(thesock)
-		, sfd(fd)
-	{
-	}
+	SocketTimeout(int fd, BufferedSocket* thesock, unsigned int secs_from_now);
 
 	/** Handle tick event
 	 */
@@ -115,7 +110,7 @@ class CoreExport StreamSocket : public EventHandler
  public:
 	/** Socket send queue
 	 */
-	class SendQueue
+	class CoreExport SendQueue
 	{
 	 public:
 		/** One element of the queue, a continuous buffer
@@ -130,6 +125,40 @@ class CoreExport StreamSocket : public EventHandler
 		 */
 		typedef Container::const_iterator const_iterator;
 
+		SendQueue() = default;
+		SendQueue(const SendQueue&) = delete;
+		SendQueue& operator=(const SendQueue&) = delete;
+
+		~SendQueue()
+		{
+			Shrink(nbytes);
+		}
+
+		/** Get the number of bytes queued in all send queues, including the queues of IO hooks.
+		 * @return Total size in bytes of all send queues.
+		 */
+		static size_t GetTotalBytes() { return totalbytes; }
+
+		/** Get the number of bytes queued in the send queues of users who are subject to the send queue budget.
+		 * @return Total size in bytes of all budgeted user send queues.
+		 */
+		static size_t GetUserBytes() { return userbytes; }
+
+		/** Sets whether this queue counts towards GetUserBytes().
+		 * @param isuser True if this is the send queue of a user who is subject to the send queue budget.
+		 */
+		void SetUserQueue(bool isuser)
+		{
+			if (user == isuser)
+				return;
+
+			user = isuser;
+			if (user)
+				userbytes += nbytes;
+			else
+				userbytes -= nbytes;
+		}
+
 		/** Return whether the queue is empty
 		 * @return True if the queue is empty, false otherwise
 		 */
@@ -166,7 +195,7 @@ class CoreExport StreamSocket : public EventHandler
 		 */
 		void pop_front()
 		{
-			nbytes -= data.front().length();
+			Shrink(data.front().length());
 			data.pop_front();
 		}
 
@@ -175,7 +204,7 @@ class CoreExport StreamSocket : public EventHandler
 		 */
 		void erase_front(Element::size_type n)
 		{
-			nbytes -= n;
+			Shrink(n);
 			data.front().erase(0, n);
 		}
 
@@ -185,7 +214,7 @@ class CoreExport StreamSocket : public EventHandler
 		void push_front(const Element& newdata)
 		{
 			data.push_front(newdata);
-			nbytes += newdata.length();
+			Grow(newdata.length());
 		}
 
 		/** Insert a new buffer at the end of the queue
@@ -194,7 +223,7 @@ class CoreExport StreamSocket : public EventHandler
 		void push_back(const Element& newdata)
 		{
 			data.push_back(newdata);
-			nbytes += newdata.length();
+			Grow(newdata.length());
 		}
 
 		/** Clear the queue
@@ -202,12 +231,28 @@ class CoreExport StreamSocket : public EventHandler
 		void clear()
 		{
 			data.clear();
-			nbytes = 0;
+			Shrink(nbytes);
+		}
+
+		/** Exchange the contents of this queue with another queue
+		 * @param other Queue to swap with
+		 */
+		void swap(SendQueue& other)
+		{
+			data.swap(other.data);
+			std::swap(nbytes, other.nbytes);
+			if (user != other.user)
+			{
+				// The bytes which moved between a user and a non-user queue need to be reaccounted.
+				const SendQueue& userq = user ? *this : other;
+				const SendQueue& otherq = user ? other : *this;
+				userbytes = userbytes + userq.nbytes - otherq.nbytes;
+			}
 		}
 
 		void moveall(SendQueue& other)
 		{
-			nbytes += other.bytes();
+			Grow(other.bytes());
 			data.insert(data.end(), other.data.begin(), other.data.end());
 			other.clear();
 		}
@@ -220,6 +265,34 @@ class CoreExport StreamSocket : public EventHandler
 		/** Length, in bytes, of the sendq
 		 */
 		size_t nbytes = 0;
+
+		/** Whether this queue is the send queue of a user who is subject to the send queue budget
+		 */
+		bool user = false;
+
+		/** Length, in bytes, of all send queues
+		 */
+		static size_t totalbytes;
+
+		/** Length, in bytes, of all budgeted user send queues
+		 */
+		static size_t userbytes;
+
+		void Grow(size_t n)
+		{
+			nbytes += n;
+			totalbytes += n;
+			if (user)
+				userbytes += n;
+		}
+
+		void Shrink(size_t n)
+		{
+			nbytes -= n;
+			totalbytes -= n;
+			if (user)
+				userbytes -= n;
+		}
 	};
 
 	/** The type of socket this IOHook represents. */
@@ -288,8 +361,9 @@ class CoreExport StreamSocket : public EventHandler
 
  public:
 	const Type type;
-	StreamSocket(Type sstype = SS_UNKNOWN)
-		: type(sstype)
+	StreamSocket(Type sstype = SS_UNKNOWN, Module* mod = nullptr)
+		: EventHandler(mod)
+		, type(sstype)
 	{
 	}
 	IOHook* GetIOHook() const;
@@ -389,15 +463,21 @@ class CoreExport BufferedSocket : public StreamSocket
 	 */
 	BufferedSocketState state;
 
-	BufferedSocket();
+	/** Creates a socket which is not connected yet.
+	 * @param mod The module which is creating this socket or nullptr if it is the core.
+	 */
+	BufferedSocket(Module* mod = nullptr);
+
 	/**
 	 * This constructor is used to associate
 	 * an existing connecting with an BufferedSocket
 	 * class. The given file descriptor must be
 	 * valid, and when initialized, the BufferedSocket
 	 * will be placed in CONNECTED state.
+	 * @param newfd The file descriptor of the connection.
+	 * @param mod The module which is creating this socket or nullptr if it is the core.
 	 */
-	BufferedSocket(int newfd);
+	BufferedSocket(int newfd, Module* mod = nullptr);
 
 	/** Begin connection to the given address
 	 * This will create a socket, register with socket engine, and start the asynchronous
@@ -48,7 +48,10 @@ class CoreExport ListModeBase : public ModeHandler
 		ModeList list;
 		int maxitems;
 
-		ChanData() : maxitems(-1) { }
+		/** A number which is changed every time the list is modified. */
+		unsigned long serial;
+
+		ChanData() : maxitems(-1), serial(0) { }
 	};
 
 	/** The number of items a listmode's list may contain
@@ -141,6 +144,13 @@ class CoreExport ListModeBase : public ModeHandler
 	 */
 	ModeList* GetList(Channel* channel);
 
+	/** Retrieves a number which changes every time the list of the given channel is modified.
+	 * This can be used to tell when data derived from the list needs to be rebuilt.
+	 * @param channel Channel to get the serial of the list for
+	 * @return The serial of the list or 0 if the channel has no list
+	 */
+	unsigned long GetSerial(Channel* channel);
+
 	/** Display the list for this mode
 	 * See mode.h
 	 * @param user The user to send the list to
@@ -217,6 +227,12 @@ class CoreExport ListModeBase : public ModeHandler
 	virtual void TellNotSet(User* source, Channel* channel, std::string& parameter);
 };
 
+inline unsigned long ListModeBase::GetSerial(Channel* channel)
+{
+	ChanData* cd = extItem.get(channel);
+	return cd ? cd->serial : 0;
+}
+
 inline ListModeBase::ModeList* ListModeBase::GetList(Channel* channel)
 {
 	ChanData* cd = extItem.get(channel);
@@ -148,6 +148,26 @@ class CoreExport LogManager
 	FileLogMap FileLogs;
 
  public:
+	/** A message which was logged on a thread that is not allowed to write to the log directly. */
+	struct CapturedMessage final
+	{
+		/** The type of the message. */
+		std::string type;
+
+		/** The level of the message. */
+		LogLevel level;
+
+		/** The message which was logged. */
+		std::string message;
+	};
+
+	/** Starts or stops capturing the messages which are logged on the calling thread.
+	 * While capturing, messages are appended to the specified list instead of being written
+	 * to the log streams. This allows worker threads to log without racing the main thread.
+	 * @param messages The list to capture messages into or nullptr to stop capturing.
+	 */
+	static void CaptureThread(std::vector<CapturedMessage>* messages);
+
 	/** Adds a FileWriter instance to LogManager, or increments the reference count of an existing instance.
 	 * Used for file-stream sharing for FileLogStreams.
 	 */
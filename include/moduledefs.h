@@ -40,8 +40,14 @@ class Module;
 #define MODULE_SYM_VERSION inspircd_module_version
 #define MODULE_STR_VERSION MODULE_STRINGIFY_SYM1(MODULE_SYM_VERSION)
 
+#ifdef PURE_STATIC
+/** Registers a module which has been linked into the core binary. */
+# define MODULE_INIT(klass) \
+	[[maybe_unused]] static const bool MODULE_SYM_INIT = DLLManager::RegisterStatic(MODNAME DLL_EXTENSION, [] () -> Module* { return new klass; });
+#else
 /** Defines the interface that a shared library must expose in order to be a module. */
-#define MODULE_INIT(klass) \
+# define MODULE_INIT(klass) \
 	extern "C" DllExport const unsigned long MODULE_SYM_ABI = MODULE_ABI; \
 	extern "C" DllExport const char MODULE_SYM_VERSION[] = INSPIRCD_VERSION; \
 	extern "C" DllExport Module* MODULE_SYM_INIT() { return new klass; }
+#endif
@@ -129,19 +129,32 @@ class ModResult
  * This #define allows us to call a method in all
  * loaded modules in a readable simple way, e.g.:
  * 'FOREACH_MOD(OnConnect,(user));'
+ *
+ * The exception handler is deliberately placed outside of the loop so that the
+ * common case where no module throws does not need to set up a handler for every
+ * module. If a module does throw then the loop is resumed from the next module.
  */
 #define FOREACH_MOD(y,x) do { \
 	const Module::List& _handlers = ServerInstance->Modules.EventHandlers[I_ ## y]; \
-	for (Module::List::const_reverse_iterator _i = _handlers.rbegin(), _next; _i != _handlers.rend(); _i = _next) \
+	ServerInstance->Modules.EventCalls[I_ ## y]++; \
+	Module::List::const_reverse_iterator _i = _handlers.rbegin(), _next = _i; \
+	while (_i != _handlers.rend()) \
 	{ \
-		_next = _i+1; \
 		try \
 		{ \
-			if (!(*_i)->dying) \
-				(*_i)->y x ; \
+			for (; _i != _handlers.rend(); _i = _next) \
+			{ \
+				_next = _i+1; \
+				if (!(*_i)->dying) \
+				{ \
+					Module::UsageTimer _timer((*_i)->hookusage); \
+					(*_i)->y x ; \
+				} \
+			} \
 		} \
 		catch (CoreException& modexcept) \
 		{ \
+			_i = _next; \
 			ServerInstance->Logs.Log("MODULE", LOG_DEFAULT, "Exception caught: " + modexcept.GetReason()); \
 		} \
 	} \
@@ -156,18 +169,28 @@ class ModResult
 #define DO_EACH_HOOK(n,v,args) \
 do { \
 	const Module::List& _handlers = ServerInstance->Modules.EventHandlers[I_ ## n]; \
-	for (Module::List::const_reverse_iterator _i = _handlers.rbegin(), _next; _i != _handlers.rend(); _i = _next) \
+	ServerInstance->Modules.EventCalls[I_ ## n]++; \
+	Module::List::const_reverse_iterator _i = _handlers.rbegin(), _next = _i; \
+	for (bool _done = false; !_done; ) \
 	{ \
-		_next = _i+1; \
 		try \
 		{ \
-			if (!(*_i)->dying) \
-				v = (*_i)->n args;
+			for (; _i != _handlers.rend(); _i = _next) \
+			{ \
+				_next = _i+1; \
+				if (!(*_i)->dying) \
+				{ \
+					Module::UsageTimer _timer((*_i)->hookusage); \
+					v = (*_i)->n args; \
+				}
 
 #define WHILE_EACH_HOOK(n) \
+			} \
+			_done = true; \
 		} \
 		catch (CoreException& except_ ## n) \
 		{ \
+			_i = _next; \
 			ServerInstance->Logs.Log("MODULE", LOG_DEFAULT, "Exception caught: " + (except_ ## n).GetReason()); \
 		} \
 	} \
@@ -201,80 +224,89 @@ class CoreExport DataProvider : public ServiceProvider
  */
 enum Priority { PRIORITY_FIRST, PRIORITY_LAST, PRIORITY_BEFORE, PRIORITY_AFTER };
 
+/** The events which modules can attach to. Each event is passed to X so that
+ * Implementation and any tables which are indexed by it, such as the event
+ * names shown in /STATS h, are generated from the same list.
+ */
+#define INSPIRCD_MODULE_EVENTS(X) \
+	X(OnAcceptConnection) \
+	X(OnAddLine) \
+	X(OnBackgroundTimer) \
+	X(OnBuildNeighborList) \
+	X(OnChangeHost) \
+	X(OnChangeIdent) \
+	X(OnChangeRealHost) \
+	X(OnChangeRealName) \
+	X(OnChannelDelete) \
+	X(OnChannelPreDelete) \
+	X(OnCheckBan) \
+	X(OnCheckChannelBan) \
+	X(OnCheckInvite) \
+	X(OnCheckKey) \
+	X(OnCheckLimit) \
+	X(OnCheckReady) \
+	X(OnCommandBlocked) \
+	X(OnConnectionFail) \
+	X(OnDecodeMetaData) \
+	X(OnDelLine) \
+	X(OnExpireLine) \
+	X(OnGarbageCollect) \
+	X(OnKill) \
+	X(OnLoadModule) \
+	X(OnMode) \
+	X(OnModuleRehash) \
+	X(OnNumeric) \
+	X(OnOper) \
+	X(OnPassCompare) \
+	X(OnPostCommand) \
+	X(OnPostConnect) \
+	X(OnPostDeoper) \
+	X(OnPostJoin) \
+	X(OnPostOper) \
+	X(OnPostTopicChange) \
+	X(OnPreChangeHost) \
+	X(OnPreChangeRealName) \
+	X(OnPreCommand) \
+	X(OnPreMode) \
+	X(OnPreRehash) \
+	X(OnPreTopicChange) \
+	X(OnRawMode) \
+	X(OnSendSnotice) \
+	X(OnServiceAdd) \
+	X(OnServiceDel) \
+	X(OnSetConnectClass) \
+	X(OnSetUserIP) \
+	X(OnShutdown) \
+	X(OnUnloadModule) \
+	X(OnUserConnect) \
+	X(OnUserDisconnect) \
+	X(OnUserInit) \
+	X(OnUserInvite) \
+	X(OnUserJoin) \
+	X(OnUserKick) \
+	X(OnUserMessage) \
+	X(OnUserMessageBlocked) \
+	X(OnUserPart) \
+	X(OnUserPostInit) \
+	X(OnUserPostMessage) \
+	X(OnUserPostNick) \
+	X(OnUserPreInvite) \
+	X(OnUserPreJoin) \
+	X(OnUserPreKick) \
+	X(OnUserPreMessage) \
+	X(OnUserPreNick) \
+	X(OnUserPreQuit) \
+	X(OnUserQuit) \
+	X(OnUserRegister) \
+	X(OnUserWrite)
+
 /** Implementation-specific flags which may be set in Module::Implements()
  */
 enum Implementation
 {
-	I_OnAcceptConnection,
-	I_OnAddLine,
-	I_OnBackgroundTimer,
-	I_OnBuildNeighborList,
-	I_OnChangeHost,
-	I_OnChangeIdent,
-	I_OnChangeRealHost,
-	I_OnChangeRealName,
-	I_OnChannelDelete,
-	I_OnChannelPreDelete,
-	I_OnCheckBan,
-	I_OnCheckChannelBan,
-	I_OnCheckInvite,
-	I_OnCheckKey,
-	I_OnCheckLimit,
-	I_OnCheckReady,
-	I_OnCommandBlocked,
-	I_OnConnectionFail,
-	I_OnDecodeMetaData,
-	I_OnDelLine,
-	I_OnExpireLine,
-	I_OnGarbageCollect,
-	I_OnKill,
-	I_OnLoadModule,
-	I_OnMode,
-	I_OnModuleRehash,
-	I_OnNumeric,
-	I_OnOper,
-	I_OnPassCompare,
-	I_OnPostCommand,
-	I_OnPostConnect,
-	I_OnPostDeoper,
-	I_OnPostJoin,
-	I_OnPostOper,
-	I_OnPostTopicChange,
-	I_OnPreChangeHost,
-	I_OnPreChangeRealName,
-	I_OnPreCommand,
-	I_OnPreMode,
-	I_OnPreRehash,
-	I_OnPreTopicChange,
-	I_OnRawMode,
-	I_OnSendSnotice,
-	I_OnServiceAdd,
-	I_OnServiceDel,
-	I_OnSetConnectClass,
-	I_OnSetUserIP,
-	I_OnShutdown,
-	I_OnUnloadModule,
-	I_OnUserConnect,
-	I_OnUserDisconnect,
-	I_OnUserInit,
-	I_OnUserInvite,
-	I_OnUserJoin,
-	I_OnUserKick,
-	I_OnUserMessage,
-	I_OnUserMessageBlocked,
-	I_OnUserPart,
-	I_OnUserPostInit,
-	I_OnUserPostMessage,
-	I_OnUserPostNick,
-	I_OnUserPreInvite,
-	I_OnUserPreJoin,
-	I_OnUserPreKick,
-	I_OnUserPreMessage,
-	I_OnUserPreNick,
-	I_OnUserPreQuit,
-	I_OnUserQuit,
-	I_OnUserRegister,
-	I_OnUserWrite,
+#define INSPIRCD_EVENT_ENUM(name) I_ ## name,
+	INSPIRCD_MODULE_EVENTS(INSPIRCD_EVENT_ENUM)
+#undef INSPIRCD_EVENT_ENUM
 	I_END
 };
 
@@ -320,6 +352,62 @@ class CoreExport Module : public classbase, public usecountbase
 	/** The properties of this module. */
 	const int properties;
 
+	/** Resource usage of one kind which has been attributed to a module. */
+	struct UsageCounter
+	{
+		/** The number of calls which have been made into the module. */
+		unsigned long calls = 0;
+
+		/** The time in nanoseconds which has been spent in the module. */
+		unsigned long long time = 0;
+	};
+
+	/** Attributes a call and the time spent until it goes out of scope to a module. */
+	class CoreExport UsageTimer final
+	{
+	 private:
+		/** The counter to attribute the call to. */
+		UsageCounter& counter;
+
+		/** Whether the time of this call is being measured. */
+		const bool timed;
+
+		/** The time at which the call started. */
+		std::chrono::steady_clock::time_point start;
+
+	 public:
+		/** Whether the time spent in modules is measured. Calls are always counted. */
+		static bool enabled;
+
+		UsageTimer(UsageCounter& usagecounter)
+			: counter(usagecounter)
+			, timed(enabled)
+		{
+			if (timed)
+				start = std::chrono::steady_clock::now();
+		}
+
+		~UsageTimer()
+		{
+			counter.calls++;
+			if (timed)
+				counter.time += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+		}
+	};
+
+	/** Usage of the event handlers and event listeners of this module. This is
+	 * mutable as event providers only hold const pointers to the module.
+	 */
+	mutable UsageCounter hookusage;
+
+	/** Usage of the command handlers of this module. */
+	UsageCounter commandusage;
+
+	/** A number which identifies this module instance. Unlike the address of
+	 * the module this is never reused after the module has been unloaded.
+	 */
+	const unsigned long serial;
+
 	/** Module setup
 	 * \exception ModuleException Throwing this class, or any class derived from ModuleException, causes loading of the module to abort.
 	 */
@@ -333,7 +421,7 @@ class CoreExport Module : public classbase, public usecountbase
 	/** Default destructor.
 	 * destroys a module class
 	 */
-	virtual ~Module() = default;
+	virtual ~Module();
 
 	/** Retrieves link compatibility data for this module.
 	 * @param data The location to store link compatibility data.
@@ -1019,6 +1107,25 @@ class CoreExport ModuleManager
 	typedef std::multimap<std::string, ServiceProvider*, irc::insensitive_swo> DataProviderMap;
 	typedef std::vector<ServiceProvider*> ServiceList;
 
+	/** The resources which are owned by a module. */
+	struct OwnedResources
+	{
+		/** The number of commands, modes, data providers and extension items registered by the module. */
+		size_t services = 0;
+
+		/** The number of extension items registered by the module. */
+		size_t extitems = 0;
+
+		/** The number of extensibles which one of the module's extension items is set on. */
+		size_t extvalues = 0;
+
+		/** The number of timers created by the module which still exist. */
+		size_t timers = 0;
+
+		/** The number of sockets created by the module which still exist. */
+		size_t sockets = 0;
+	};
+
  private:
 	/** Holds a string describing the last module error to occur
 	 */
@@ -1035,10 +1142,49 @@ class CoreExport ModuleManager
 		PRIO_STATE_LAST
 	} prioritizationState;
 
+	/** Expensive initialization work which has been deferred until the end of the current phase of startup. */
+	struct StartupTask final
+	{
+		/** The module which added the task. */
+		Module* creator;
+
+		/** A human readable description of the task. */
+		std::string name;
+
+		/** The work to perform on a worker thread. */
+		std::function<void()> work;
+
+		/** The function to call on the main thread once the work has completed. */
+		std::function<void()> done;
+
+		/** The messages which were logged by the work. */
+		std::vector<LogManager::CapturedMessage> messages;
+
+		/** The exception which was thrown by the work if it failed. */
+		std::exception_ptr error;
+
+		/** How long the work took. */
+		std::chrono::steady_clock::duration time;
+	};
+
+	/** Whether startup tasks are being deferred so that they can be run in parallel. */
+	bool DeferStartupTasks = false;
+
+	/** The startup tasks which are waiting to be run. */
+	std::vector<StartupTask> StartupTasks;
+
 	/** Loads all core modules (core_*)
 	 */
 	void LoadCoreModules(std::map<std::string, ServiceList>& servicemap);
 
+	/** Runs the pending startup tasks in parallel and waits for them to complete. If a task fails
+	 * then the server exits.
+	 * @param phase The name of the startup phase which added the tasks.
+	 * @param action The action which was being performed when the tasks were added (e.g. "initialize").
+	 * @param exitcode The status code to exit with if a task fails.
+	 */
+	void RunStartupTasks(const std::string& phase, const std::string& action, int exitcode);
+
 	/** Calls the Prioritize() method in all loaded modules
 	 * @return True if all went well, false if a dependency loop was detected
 	 */
@@ -1058,6 +1204,11 @@ class CoreExport ModuleManager
 	 */
 	Module::List EventHandlers[I_END];
 
+	/** The number of times each event has been dispatched since startup.
+	 * This is incremented once per dispatch rather than once per module.
+	 */
+	unsigned long EventCalls[I_END] = { };
+
 	/** List of data services keyed by name */
 	DataProviderMap DataProviders;
 
@@ -1163,6 +1314,24 @@ class CoreExport ModuleManager
 	/** Called by the InspIRCd constructor to load all modules from the config file.
 	 */
 	void LoadAll();
+
+	/** Performs expensive initialization work for a module such as loading a database or creating
+	 * TLS contexts. While the server is starting up the work is deferred until every module has
+	 * finished the current phase of initialization (init() or ReadConfig()) and is then run in
+	 * parallel with the work of other modules. At any other time it is performed immediately.
+	 *
+	 * As the work may run on a worker thread it must not modify anything other than its own
+	 * results. Messages logged by it are written out once it has completed and exceptions thrown
+	 * by it are handled in the same way as ones thrown by the phase which added the task.
+	 *
+	 * @param mod The module which is adding the task.
+	 * @param name A human readable description of the task which is used in the startup profile.
+	 * @param work The work to perform or nullptr if only \p done should be called.
+	 * @param done If non-null then a function to call on the main thread once the work has been
+	 *             performed. These are called in the order that tasks were added so a task with
+	 *             no work can be used to apply the results of the tasks which were added before it.
+	 */
+	void AddStartupTask(Module* mod, const std::string& name, std::function<void()> work, std::function<void()> done = nullptr);
 	void UnloadAll();
 	void DoSafeUnload(Module*);
 
@@ -1222,4 +1391,11 @@ class CoreExport ModuleManager
 	 * @param service Service to make no longer referenceable by dynamic_references
 	 */
 	void DelReferent(ServiceProvider* service);
+
+	/** Counts the resources which are owned by a module. This walks every
+	 * registered service so it should not be called on a hot path.
+	 * @param mod The module to count the resources of.
+	 * @return The resources which are owned by the module.
+	 */
+	OwnedResources GetOwnedResources(const Module* mod) const;
 };
@@ -29,10 +29,28 @@ namespace Cap
 	static const unsigned int MAX_VALUE_LENGTH = 100;
 
 	typedef intptr_t Ext;
+
+	/** Serializes the capabilities of a user. The capabilities themselves are stored in
+	 * LocalUser::capabilities; this extension item mirrors them so that they are included
+	 * when the user is serialized.
+	 */
 	class ExtItem : public IntExtItem
 	{
 	 public:
 		ExtItem(Module* mod);
+
+		/** Changes the capabilities of a user.
+		 * @param user The user to change the capabilities of.
+		 * @param caps The new capability mask of the user.
+		 */
+		void SetCaps(LocalUser* user, Ext caps)
+		{
+			user->capabilities = caps;
+			if (caps)
+				set(user, caps);
+			else
+				unset(user);
+		}
 		void FromInternal(Extensible* container, const std::string& value) override;
 		std::string ToHuman(const Extensible* container, void* item) const override;
 		std::string ToInternal(const Extensible* container, void* item) const override;
@@ -124,7 +142,7 @@ namespace Cap
 		 */
 		Bit bit;
 
-		/** Extension containing all caps set by a user. NULL if the cap is unregistered.
+		/** Extension which serializes the caps set by a user. NULL if the cap is unregistered.
 		 */
 		ExtItem* extitem;
 
@@ -195,10 +213,9 @@ namespace Cap
 		 */
 		bool IsEnabled(User* user) const
 		{
-			if (!IsRegistered())
-				return false;
-			Ext caps = extitem->get(user);
-			return ((caps & GetMask()) != 0);
+			// The bit is zero if the cap is unregistered so no registration check is needed here.
+			LocalUser* const luser = IS_LOCAL(user);
+			return luser && (luser->capabilities & GetMask());
 		}
 
 		/** Turn the capability on/off for a user. If the cap is not registered this method has no effect.
@@ -207,10 +224,10 @@ namespace Cap
 		 */
 		void Set(User* user, bool val)
 		{
-			if (!IsRegistered())
+			LocalUser* const luser = IS_LOCAL(user);
+			if (!IsRegistered() || !luser)
 				return;
-			Ext curr = extitem->get(user);
-			extitem->set(user, (val ? AddToMask(curr) : DelFromMask(curr)));
+			extitem->SetCaps(luser, (val ? AddToMask(luser->capabilities) : DelFromMask(luser->capabilities)));
 		}
 
 		/** Activate or deactivate the capability.
@@ -254,7 +271,7 @@ namespace Cap
 		 */
 		Protocol GetProtocol(LocalUser* user) const
 		{
-			return ((IsRegistered() && (extitem->get(user) & CAP_302_BIT)) ? CAP_302 : CAP_LEGACY);
+			return ((IsRegistered() && (user->capabilities & CAP_302_BIT)) ? CAP_302 : CAP_LEGACY);
 		}
 
 		/** Called when a user requests to turn this capability on or off.
@@ -179,7 +179,7 @@ namespace DNS
 		Module* const creator;
 
 		Request(Manager* mgr, Module* mod, const std::string& addr, QueryType qt, bool usecache = true)
-			: Timer(ServerInstance->Config->ConfValue("dns")->getDuration("timeout", 5, 1))
+			: Timer(ServerInstance->Config->ConfValue("dns")->getDuration("timeout", 5, 1), false, mod)
 			, manager(mgr)
 			, question(addr, qt)
 			, use_cache(usecache)
@@ -20,6 +20,7 @@
 #pragma once
 
 #include "event.h"
+#include "listmode.h"
 
 namespace ExtBan
 {
@@ -28,6 +29,7 @@ namespace ExtBan
 	class EventListener;
 	class MatchingBase;
 	class Manager;
+	class ManagerRef;
 
 	/** All possible types of extban. */
 	enum class Type
@@ -69,6 +71,9 @@ class ExtBan::Manager
 	/** A mapping of extban names to their associated objects. */
 	typedef std::unordered_map<std::string, ExtBan::Base*, irc::insensitive, irc::StrHashComp> NameMap;
 
+	/** A list of list mode entries which matched a user. */
+	typedef std::vector<const ListModeBase::ListItem*> MatchList;
+
 	/** Registers an extban with the manager.
 	 * @param extban The extban instance to register.
 	 */
@@ -94,6 +99,22 @@ class ExtBan::Manager
 	 */
 	virtual ModResult GetStatus(Acting* extban, User* user, Channel* channel) const = 0;
 
+	/** Searches the entries of a list mode for ones which match a user. Entries for matching
+	 * extbans which support MatchingBase::GetMatchKey and do not contain wildcards are found
+	 * using an index of the list; all other entries are checked with Channel::CheckBan.
+	 * @param mode The list mode to search.
+	 * @param user The user to match entries against.
+	 * @param channel The channel which the list mode is set on.
+	 * @param acting If non-null then search the entries for this acting extban instead of the
+	 *               entries which are not for an acting extban.
+	 * @param matches If non-null then every entry which matches is added to this list; otherwise,
+	 *                the search stops at the first match.
+	 * @param prefixed Whether entries are prefixed with a field and a colon which is not part of
+	 *                 the mask (e.g. "o:*!*@example.com").
+	 * @return True if at least one entry matched; otherwise, false.
+	 */
+	virtual bool FindMatches(ListModeBase* mode, User* user, Channel* channel, Acting* acting = nullptr, MatchList* matches = nullptr, bool prefixed = false) const = 0;
+
 	/** Finds an extban by letter.
 	 * @param letter The letter of the extban to find.
 	 */
@@ -241,6 +262,30 @@ class ExtBan::MatchingBase
 
 	/** @copydoc ExtBan::Base::IsMatch */
 	virtual bool IsMatch(User* user, Channel* channel, const std::string& text) override = 0;
+
+	/** Determines whether this extban supports GetMatchKey. */
+	virtual bool HasMatchKey() const { return false; }
+
+	/** Retrieves the value of a user which the text of this extban is matched against. This
+	 * should only be implemented by extbans where IsMatch is equivalent to matching this value
+	 * against the text with InspIRCd::Match as it allows entries which do not contain wildcards
+	 * to be found with a hash lookup instead of by calling IsMatch for every entry.
+	 * @param user The user to retrieve the value of.
+	 * @param key The location to store the value in.
+	 * @return True if the user has a value; otherwise, false (the user matches no entries).
+	 */
+	virtual bool GetMatchKey(User* user, std::string& key) { return false; }
+};
+
+/** A reference to the extban manager. */
+class ExtBan::ManagerRef
+	: public dynamic_reference_nocheck<Manager>
+{
+ public:
+	ManagerRef(Module* mod)
+		: dynamic_reference_nocheck<Manager>(mod, "extbanmanager")
+	{
+	}
 };
 
 /** Provides events relating to extbans. */
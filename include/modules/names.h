@@ -24,6 +24,19 @@
 namespace Names
 {
 	class EventListener;
+
+	/** Flags which describe how the entries in a cached NAMES list are formatted. */
+	enum Format
+	{
+		/** Show all of the prefix characters of a member instead of just their highest one. */
+		FORMAT_ALL_PREFIXES = 1,
+
+		/** Show the nick!user@host of a member instead of just their nick. */
+		FORMAT_USERHOST = 2,
+
+		/** The number of distinct format combinations. */
+		FORMAT_COUNT = 4
+	};
 }
 
 class Names::EventListener : public Events::ModuleEventListener
@@ -43,4 +56,17 @@ class Names::EventListener : public Events::ModuleEventListener
 	 * excluded from this NAMES list
 	 */
 	virtual ModResult OnNamesListItem(LocalUser* issuer, Membership* memb, std::string& prefixes, std::string& nick) = 0;
+
+	/* Called before a NAMES list for a channel is sent to a member of that channel to determine whether a
+	 * cached copy of the list can be sent instead of calling OnNamesListItem for every member.
+	 * @param issuer The user who initiated the NAMES request.
+	 * @param chan The channel that the NAMES list is being sent for.
+	 * @param format A bitmask of values from Names::Format which the cached list should be formatted with.
+	 * @return Return MOD_RES_PASSTHRU if this listener only changes the NAMES list in a way that can be
+	 * described by format or MOD_RES_DENY if OnNamesListItem must be called for every member.
+	 */
+	virtual ModResult OnNamesListPrepare(LocalUser* issuer, Channel* chan, unsigned int& format)
+	{
+		return MOD_RES_DENY;
+	}
 };
@@ -64,6 +64,8 @@ enum
 	RPL_ADMINLOC2                   = 258,
 	RPL_ADMINEMAIL                  = 259,
 
+	RPL_TRYAGAIN                    = 263,
+
 	RPL_LOCALUSERS                  = 265,
 	RPL_GLOBALUSERS                 = 266,
 
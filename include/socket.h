@@ -103,6 +103,42 @@ namespace irc
 			std::string str() const;
 		};
 
+		/** A mask which can be matched against an IP address. If the mask is a CIDR range it is parsed
+		 * when the mask is created so that matching it is just a comparison of the binary address with
+		 * the masked bits; otherwise, it is matched as a glob pattern against the address string.
+		 */
+		class CoreExport address_mask
+		{
+		 private:
+			/** The mask in the form it was specified. */
+			std::string mask;
+
+			/** Whether the mask is a valid CIDR range. */
+			bool iscidr = false;
+
+			/** If iscidr is true then the binary form of the CIDR range. */
+			cidr_mask cidr;
+
+		 public:
+			address_mask() = default;
+
+			/** Construct an address mask from a glob pattern or a CIDR range. */
+			address_mask(const std::string& m);
+
+			/** Whether this mask is a CIDR range. */
+			bool is_cidr() const { return iscidr; }
+
+			/** Determines whether this mask matches an address.
+			 * @param addr The binary form of the address.
+			 * @param addrstr The human readable form of the address (e.g. from User::GetIPString()).
+			 * @return True if this mask matches the address; otherwise, false.
+			 */
+			bool match(const irc::sockets::sockaddrs& addr, const std::string& addrstr) const;
+
+			/** The mask in the form it was specified. */
+			const std::string& str() const { return mask; }
+		};
+
 		/** Match CIDR, including an optional username/nickname part.
 		 *
 		 * This function will compare a human-readable address (plus
@@ -206,4 +242,9 @@ class CoreExport ListenSocket : public EventHandler
 	 * provider which this socket will use for incoming connections.
 	 */
 	void ResetIOHookProvider();
+
+	/** Determines whether this socket has any IO hook providers configured.
+	 * @return True if an IO hook provider is configured; otherwise, false.
+	 */
+	bool HasIOHooks() const;
 };
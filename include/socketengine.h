@@ -31,6 +31,7 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <unordered_map>
 #include "config.h"
 #include "socket.h"
 #include "base.h"
@@ -160,6 +161,13 @@ class CoreExport EventHandler : public classbase
 	/** Private state maintained by socket engine */
 	int event_mask;
 
+	/** The trial generation in which this handler was added to the trial list or 0 if it is not in the list. */
+	unsigned long trialgen = 0;
+
+	/** The previous and next handlers in the trial list. */
+	EventHandler* trialprev = nullptr;
+	EventHandler* trialnext = nullptr;
+
 	void SetEventMask(int mask) { event_mask = mask; }
 
  protected:
@@ -194,13 +202,22 @@ class CoreExport EventHandler : public classbase
 	 */
 	void SetFd(int FD);
 
+	/** The module which created this event handler or nullptr if it was created by the core. This
+	 * must not be dereferenced as the event handler may outlive the module if it is leaked.
+	 */
+	Module* const owner;
+
+	/** The serial of the module which created this event handler or 0 if it was created by the core. */
+	const unsigned long ownerserial;
+
 	/** Constructor
+	 * @param mod The module which is creating this event handler or nullptr if it is the core.
 	 */
-	EventHandler();
+	EventHandler(Module* mod = nullptr);
 
 	/** Destructor
 	 */
-	virtual ~EventHandler() = default;
+	virtual ~EventHandler();
 
 	/** Called by the socket engine in case of a read event
 	 */
@@ -282,9 +299,28 @@ class CoreExport SocketEngine
 	/** The maximum number of descriptors in the engine. */
 	static size_t MaxSetSize;
 
-	/** List of handlers that want a trial read/write
+	/** The number of event handlers which exist for each loaded module that has created one, keyed by module serial. */
+	static std::unordered_map<unsigned long, size_t> OwnedHandlers;
+
+	/** The number of event handlers which still exist after the module which created them was unloaded. */
+	static size_t OrphanedHandlers;
+
+	friend class EventHandler;
+
+	/** List of handlers that want a trial read/write in the order they asked for it.
+	 * The list is linked through EventHandler::trialprev and EventHandler::trialnext.
 	 */
-	static std::set<int> trials;
+	static EventHandler* trialhead;
+	static EventHandler* trialtail;
+
+	/** The generation of trials which will be dispatched next. */
+	static unsigned long trialgen;
+
+	/** Adds a handler to the end of the trial list if it is not already in it. */
+	static void AddTrial(EventHandler* eh);
+
+	/** Removes a handler from the trial list if it is in it. */
+	static void DelTrial(EventHandler* eh);
 
 	/** Socket engine statistics: count of various events, bandwidth usage
 	 */
@@ -380,6 +416,23 @@ public:
 	 */
 	static void DelFd(EventHandler* eh);
 
+	/** Retrieves the number of event handlers which currently exist for a module.
+	 * @param mod The module to count the event handlers of.
+	 * @return The number of event handlers which were created by the module and have not been destroyed.
+	 */
+	static size_t GetOwnedHandlers(const Module* mod);
+
+	/** Retrieves the number of event handlers which still exist after the module which created them was unloaded.
+	 * @return The number of event handlers which have been leaked by unloaded modules.
+	 */
+	static size_t GetOrphanedHandlers() { return OrphanedHandlers; }
+
+	/** Stops counting the event handlers of a module which is being destroyed against it.
+	 * @param mod The module which is being destroyed.
+	 * @return The number of event handlers created by the module which still exist.
+	 */
+	static size_t OrphanHandlers(const Module* mod);
+
 	/** Returns true if a file descriptor exists in
 	 * the socket engine's list.
 	 * @param fd The event handler to look for
@@ -395,14 +448,23 @@ public:
 	static EventHandler* GetRef(int fd);
 
 	/** Waits for events and dispatches them to handlers.  Please note that
-	 * this doesn't wait long, only a couple of milliseconds. It returns the
-	 * number of events which occurred during this call.  This method will
-	 * dispatch events to their handlers by calling their
+	 * this only waits until the next timer is due (see GetDispatchTimeout()).
+	 * It returns the number of events which occurred during this call.  This
+	 * method will dispatch events to their handlers by calling their
 	 * EventHandler::OnEventHandler*() methods.
 	 * @return The number of events which have occurred.
 	 */
 	static int DispatchEvents();
 
+	/** The maximum number of milliseconds DispatchEvents() will wait for events. */
+	static const unsigned int MAX_DISPATCH_TIMEOUT = 1000;
+
+	/** Retrieves the number of milliseconds DispatchEvents() should wait for
+	 * events. This is 0 if there are trial reads or writes pending and
+	 * otherwise the time until the next timer is due.
+	 */
+	static unsigned int GetDispatchTimeout();
+
 	/** Dispatch trial reads and writes. This causes the actual socket I/O
 	 * to happen when writes have been pre-buffered.
 	 */
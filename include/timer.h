@@ -28,11 +28,12 @@
 
 class Module;
 
-/** Timer class for one-second resolution timers
+/** Timer class for one-second or one-millisecond resolution timers
  * Timer provides a facility which allows module
  * developers to create one-shot timers. The timer
  * can be made to trigger at any time up to a one-second
- * resolution. To use Timer, inherit a class from
+ * resolution or, if it is created with a std::chrono::milliseconds
+ * interval, up to a one-millisecond resolution. To use Timer, inherit a class from
  * Timer, then insert your inherited class into the
  * queue using Server::AddTimer(). The Tick() method of
  * your object (which you have to override) will be called
@@ -40,24 +41,42 @@ class Module;
  */
 class CoreExport Timer
 {
-	/** The triggering time
+	friend class TimerManager;
+
+	/** The triggering time in milliseconds since the UNIX epoch
 	 */
-	time_t trigger;
+	uint64_t trigger;
 
-	/** Number of seconds between triggers
+	/** Number of milliseconds between triggers
 	 */
-	unsigned int secs;
+	uint64_t interval;
 
 	/** True if this is a repeating timer
 	 */
 	bool repeat;
 
  public:
+	/** The module which created this timer or nullptr if it was created by the core. This
+	 * must not be dereferenced as the timer may outlive the module if it is leaked.
+	 */
+	Module* const owner;
+
+	/** The serial of the module which created this timer or 0 if it was created by the core. */
+	const unsigned long ownerserial;
+
 	/** Default constructor, initializes the triggering time
 	 * @param secs_from_now The number of seconds from now to trigger the timer
 	 * @param repeating Repeat this timer every secs_from_now seconds if set to true
+	 * @param mod The module which is creating this timer or nullptr if it is the core
 	 */
-	Timer(unsigned int secs_from_now, bool repeating = false);
+	Timer(unsigned int secs_from_now, bool repeating = false, Module* mod = nullptr);
+
+	/** Initializes the triggering time with millisecond resolution
+	 * @param ms_from_now The number of milliseconds from now to trigger the timer
+	 * @param repeating Repeat this timer every ms_from_now milliseconds if set to true
+	 * @param mod The module which is creating this timer or nullptr if it is the core
+	 */
+	Timer(std::chrono::milliseconds ms_from_now, bool repeating = false, Module* mod = nullptr);
 
 	/** Default destructor, removes the timer from the timer manager
 	 */
@@ -66,6 +85,13 @@ class CoreExport Timer
 	/** Retrieve the current triggering time
 	 */
 	time_t GetTrigger() const
+	{
+		return trigger / 1000;
+	}
+
+	/** Retrieve the current triggering time in milliseconds since the UNIX epoch
+	 */
+	uint64_t GetTriggerMS() const
 	{
 		return trigger;
 	}
@@ -76,12 +102,16 @@ class CoreExport Timer
 	 */
 	void SetTrigger(time_t nexttrigger)
 	{
-		trigger = nexttrigger;
+		trigger = uint64_t(nexttrigger) * 1000;
 	}
 
 	/** Sets the interval between two ticks.
 	 */
-	void SetInterval(unsigned int interval);
+	void SetInterval(unsigned int newinterval);
+
+	/** Sets the interval between two ticks with millisecond resolution.
+	 */
+	void SetInterval(std::chrono::milliseconds newinterval);
 
 	/** Called when the timer ticks.
 	 * You should override this method with some useful code to
@@ -103,7 +133,15 @@ class CoreExport Timer
 	 */
 	unsigned int GetInterval() const
 	{
-		return secs;
+		return interval / 1000;
+	}
+
+	/** Returns the interval (number of milliseconds between ticks)
+	 * of this timer object.
+	 */
+	uint64_t GetIntervalMS() const
+	{
+		return interval;
 	}
 
 	/** Cancels the repeat state of a repeating timer.
@@ -122,17 +160,41 @@ class CoreExport Timer
  */
 class CoreExport TimerManager
 {
-	typedef std::multimap<time_t, Timer*> TimerMap;
+	typedef std::multimap<uint64_t, Timer*> TimerMap;
 
 	/** A list of all pending timers
 	 */
 	TimerMap Timers;
 
+	/** The number of timers which exist for each loaded module that has created one, keyed by module serial
+	 */
+	std::unordered_map<unsigned long, size_t> OwnedTimers;
+
+	/** The number of timers which still exist after the module which created them was unloaded
+	 */
+	size_t OrphanedTimers = 0;
+
+	friend class Timer;
+
+	/** The time at which timers were last ticked in milliseconds since the UNIX epoch
+	 */
+	uint64_t lasttick = 0;
+
  public:
+	/** The number of milliseconds a timer can be delayed by so that it can be ticked with other timers
+	 */
+	static const uint64_t COALESCE_MS = 10;
+
 	/** Tick all pending Timers
-	 * @param TIME the current system time
+	 * @param now The current system time in milliseconds since the UNIX epoch
 	 */
-	void TickTimers(time_t TIME);
+	void TickTimers(uint64_t now);
+
+	/** Retrieves the number of milliseconds until the next pending timers should be ticked
+	 * @param maxtimeout The maximum number of milliseconds to return
+	 * @return The number of milliseconds to wait for or 0 if there are timers due now
+	 */
+	unsigned int GetTimeout(unsigned int maxtimeout) const;
 
 	/** Add an Timer
 	 * @param T an Timer derived class to add
@@ -143,4 +205,21 @@ class CoreExport TimerManager
 	 * @param T an Timer derived class to remove
 	 */
 	void DelTimer(Timer* T);
+
+	/** Retrieves the number of timers which currently exist for a module
+	 * @param mod The module to count the timers of
+	 * @return The number of timers which were created by the module and have not been destroyed
+	 */
+	size_t GetOwnedTimers(const Module* mod) const;
+
+	/** Retrieves the number of timers which still exist after the module which created them was unloaded
+	 * @return The number of timers which have been leaked by unloaded modules
+	 */
+	size_t GetOrphanedTimers() const { return OrphanedTimers; }
+
+	/** Stops counting the timers of a module which is being destroyed against it
+	 * @param mod The module which is being destroyed
+	 * @return The number of timers created by the module which still exist
+	 */
+	size_t OrphanTimers(const Module* mod);
 };
@@ -65,13 +65,50 @@ namespace ClientProtocol
 	typedef std::vector<std::string> ParamList;
 	typedef std::string SerializedMessage;
 
+	/** An immutable message tag value. Copies of a tag value share the same string so copying a tag
+	 * between messages, events and history entries does not copy the value itself.
+	 */
+	class TagValue
+	{
+	 private:
+		/** The shared value of the tag or nullptr if the tag has no value. */
+		std::shared_ptr<const std::string> value;
+
+	 public:
+		TagValue() = default;
+
+		TagValue(const std::string& val)
+			: value(val.empty() ? nullptr : std::make_shared<const std::string>(val))
+		{
+		}
+
+		TagValue(const char* val)
+			: TagValue(std::string(val))
+		{
+		}
+
+		/** Retrieves the value of the tag. */
+		const std::string& get() const
+		{
+			static const std::string emptystr;
+			return value ? *value : emptystr;
+		}
+
+		/** Determines whether the tag has no value. */
+		bool empty() const { return !value; }
+
+		operator const std::string&() const { return get(); }
+		bool operator==(const std::string& other) const { return get() == other; }
+		bool operator!=(const std::string& other) const { return get() != other; }
+	};
+
 	struct MessageTagData
 	{
 		MessageTagProvider* tagprov;
-		std::string value;
+		TagValue value;
 		void* provdata;
 
-		MessageTagData(MessageTagProvider* prov, const std::string& val, void* data = NULL);
+		MessageTagData(MessageTagProvider* prov, const TagValue& val, void* data = NULL);
 	};
 
 	/** Map of message tag values and providers keyed by their name.
@@ -104,6 +104,23 @@ class CoreExport UserManager
 	 */
 	void DoBackgroundUserStuff();
 
+	/** Determines whether a command which produces a lot of output should be refused because the
+	 * send queues of all users are close to exceeding <performance:sendqbudget>. Refusals are
+	 * counted in the server stats.
+	 * @param user The user who the output would be sent to.
+	 * @return True if the output should not be produced; otherwise, false.
+	 */
+	bool ThrottleOutput(LocalUser* user);
+
+	/** Checks whether a client connection from the specified address is banned before any state
+	 * is allocated for it using the ban cache and the Z-lines. Matching Z-lines are added to the
+	 * ban cache and connections which an E-line exempts are never rejected here.
+	 * @param client The IP address and client port of the connection.
+	 * @param reason If the connection is banned then the reason it was banned.
+	 * @return True if the connection should be rejected; otherwise, false.
+	 */
+	bool IsBannedConnection(const irc::sockets::sockaddrs& client, std::string& reason);
+
 	/** Handle a client connection.
 	 * Creates a new LocalUser object, inserts it into the appropriate containers,
 	 * initializes it as not yet registered, and adds it to the socket engine.
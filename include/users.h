@@ -88,6 +88,10 @@ struct CoreExport ConnectClass
 	 */
 	std::string host;
 
+	/** Host mask for this line pre-parsed for matching against the IP address of a user
+	 */
+	irc::sockets::address_mask hostaddr;
+
 	/** Number of seconds between pings for this line
 	 */
 	unsigned int pingtime = 0;
@@ -631,15 +635,41 @@ class CoreExport User : public Extensible
 class CoreExport UserIOHandler : public StreamSocket
 {
  private:
-	 size_t checked_until;
+	/** Processes the lines which were held back by fake lag once the user's penalty has dropped far enough. */
+	class FakeLagTimer final : public Timer
+	{
+	 private:
+		/** The handler which owns this timer. */
+		UserIOHandler& handler;
+
+	 public:
+		FakeLagTimer(UserIOHandler& eh)
+			: Timer(std::chrono::milliseconds(0))
+			, handler(eh)
+		{
+		}
+
+		bool Tick(time_t) override
+		{
+			handler.OnDataReady();
+			return true;
+		}
+	};
+
+	size_t checked_until;
+
+	/** The time at which the user's command flood penalty was last reduced in milliseconds since the UNIX epoch. */
+	uint64_t lastpenaltydecay;
+
+	/** Schedules the processing of lines which are held back by fake lag. */
+	FakeLagTimer fakelagtimer;
+
+	/** Reduces the command flood penalty of the user by the amount which has expired since it was last reduced. */
+	void DecayPenalty();
+
  public:
 	LocalUser* const user;
-	UserIOHandler(LocalUser* me)
-		: StreamSocket(StreamSocket::SS_USER)
-		, checked_until(0)
-		, user(me)
-	{
-	}
+	UserIOHandler(LocalUser* me);
 	void OnDataReady() override;
 	bool OnSetLocalEndPoint(const irc::sockets::sockaddrs& ep) override;
 	bool OnSetRemoteEndPoint(const irc::sockets::sockaddrs& ep) override;
@@ -652,6 +682,11 @@ class CoreExport UserIOHandler : public StreamSocket
 	 */
 	void AddWriteBuf(const std::string &data);
 
+	/** Determines whether the recvq contains a complete line which has not been processed yet.
+	 * @return True if a line is waiting to be processed; otherwise, false.
+	 */
+	bool HasPendingLine() const { return recvq.find('\n', checked_until) != std::string::npos; }
+
 	/** Swaps the internals of this UserIOHandler with another one.
 	 * @param other A UserIOHandler to swap internals with.
 	 */
@@ -757,6 +792,12 @@ class CoreExport LocalUser : public User, public insp::intrusive_list_node<Local
 
 	already_sent_t already_sent = 0;
 
+	/** The client capabilities which this user has enabled. Each capability which is registered with
+	 * the cap module owns a single bit of this mask so checking whether a capability is enabled does
+	 * not need to look up an extension item.
+	 */
+	intptr_t capabilities = 0;
+
 	/** Check if the user matches a G- or K-line, and disconnect them if they do.
 	 * @param doZline True if Z-lines should be checked (if IP has changed since initial connect)
 	 * Returns true if the user matched a ban, false else.
@@ -829,6 +870,13 @@ class CoreExport LocalUser : public User, public insp::intrusive_list_node<Local
 	 */
 	void Send(ClientProtocol::EventProvider& protoevprov, ClientProtocol::Message& msg);
 
+	/** Send a numeric to the user.
+	 * If nothing can modify the numeric before it is sent then it is serialized directly into a
+	 * reused buffer instead of being turned into a ClientProtocol::Message first.
+	 * @param numeric Numeric to send.
+	 */
+	void SendNumeric(const Numeric::Numeric& numeric);
+
 	/** @copydoc Serializable::Deserialize */
 	bool Deserialize(Data& data) override;
 
@@ -167,7 +167,7 @@ class CoreExport KLine : public XLine
 	 * @param host Host to match
 	 */
 	KLine(time_t s_time, unsigned long d, const std::string& src, const std::string& re, const std::string& ident, const std::string& host)
-		: XLine(s_time, d, src, re, "K"), identmask(ident), hostmask(host)
+		: XLine(s_time, d, src, re, "K"), identmask(ident), hostmask(host), hostaddr(host)
 	{
 		matchtext = this->identmask;
 		matchtext.append("@").append(this->hostmask);
@@ -190,6 +190,10 @@ class CoreExport KLine : public XLine
 	 */
 	std::string hostmask;
 
+	/** Host mask pre-parsed for matching against the IP address of a user
+	 */
+	irc::sockets::address_mask hostaddr;
+
 	std::string matchtext;
 };
 
@@ -207,7 +211,7 @@ class CoreExport GLine : public XLine
 	 * @param host Host to match
 	 */
 	GLine(time_t s_time, unsigned long d, const std::string& src, const std::string& re, const std::string& ident, const std::string& host)
-		: XLine(s_time, d, src, re, "G"), identmask(ident), hostmask(host)
+		: XLine(s_time, d, src, re, "G"), identmask(ident), hostmask(host), hostaddr(host)
 	{
 		matchtext = this->identmask;
 		matchtext.append("@").append(this->hostmask);
@@ -228,6 +232,10 @@ class CoreExport GLine : public XLine
 	 */
 	std::string hostmask;
 
+	/** Host mask pre-parsed for matching against the IP address of a user
+	 */
+	irc::sockets::address_mask hostaddr;
+
 	std::string matchtext;
 };
 
@@ -245,7 +253,7 @@ class CoreExport ELine : public XLine
 	 * @param host Host to match
 	 */
 	ELine(time_t s_time, unsigned long d, const std::string& src, const std::string& re, const std::string& ident, const std::string& host)
-		: XLine(s_time, d, src, re, "E"), identmask(ident), hostmask(host)
+		: XLine(s_time, d, src, re, "E"), identmask(ident), hostmask(host), hostaddr(host)
 	{
 		matchtext = this->identmask;
 		matchtext.append("@").append(this->hostmask);
@@ -268,6 +276,10 @@ class CoreExport ELine : public XLine
 	 */
 	std::string hostmask;
 
+	/** Host mask pre-parsed for matching against the IP address of a user
+	 */
+	irc::sockets::address_mask hostaddr;
+
 	std::string matchtext;
 };
 
@@ -284,7 +296,7 @@ class CoreExport ZLine : public XLine
 	 * @param ip IP to match
 	 */
 	ZLine(time_t s_time, unsigned long d, const std::string& src, const std::string& re, const std::string& ip)
-		: XLine(s_time, d, src, re, "Z"), ipaddr(ip)
+		: XLine(s_time, d, src, re, "Z"), ipaddr(ip), ipmask(ip)
 	{
 	}
 
@@ -299,6 +311,10 @@ class CoreExport ZLine : public XLine
 	/** IP mask (no ident part)
 	 */
 	std::string ipaddr;
+
+	/** IP mask pre-parsed for matching against the IP address of a user
+	 */
+	irc::sockets::address_mask ipmask;
 };
 
 /** QLine class
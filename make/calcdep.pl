@@ -49,6 +49,7 @@ sub dep_cpp($$$);
 sub dep_so($);
 sub dep_dir($$);
 sub run();
+sub run_modules();
 
 my %f2dep;
 
@@ -62,7 +63,7 @@ sub run() {
 	unlink 'vendor';
 	symlink "${\SOURCEPATH}/include", 'include';
 	symlink "${\SOURCEPATH}/vendor", 'vendor';
-	mkdir $_ for qw/bin modules obj/;
+	mkdir $_ for qw(bin modules obj obj/bench);
 
 	open MAKE, '>real.mk' or die "Could not write real.mk: $!";
 	chdir "${\SOURCEPATH}/src";
@@ -86,7 +87,7 @@ bad-target:
 all: inspircd modules
 
 END
-	my(@core_deps, @modlist);
+	my @core_deps;
 	for my $file (<*.cpp>, <socketengines/*.cpp>) {
 		my $out = find_output $file;
 		dep_cpp $file, $out, 'gen-o';
@@ -100,6 +101,47 @@ END
 		push @core_deps, $out;
 	}
 
+	# The benchmarks link against every core object except the one containing
+	# main() so that they can exercise core code without a server instance.
+	my @bench_deps = grep { $_ ne 'obj/inspircd.o' } @core_deps;
+	for my $file (<bench/*.cpp>) {
+		my $out = find_output $file;
+		dep_cpp $file, $out, 'gen-o';
+		unshift @bench_deps, $out;
+	}
+
+	# When building a monolithic binary the modules are linked into the core
+	# binary instead of being built as shared libraries.
+	my @modlist = run_modules();
+	if ($ENV{PURE_STATIC}) {
+		push @core_deps, @modlist;
+		@modlist = ();
+	}
+
+	my $core_mk = join ' ', @core_deps;
+	my $mods = join ' ', @modlist;
+	my $bench_mk = join ' ', @bench_deps;
+	print MAKE <<END;
+
+bin/inspircd: $core_mk
+	@\$(SOURCEPATH)/make/unit-cc.pl core-ld \$\@ \$^ \$>
+
+inspircd: bin/inspircd
+
+bin/inspircd-bench: $bench_mk
+	@\$(SOURCEPATH)/make/unit-cc.pl core-ld \$\@ \$^ \$>
+
+inspircd-bench: bin/inspircd-bench
+
+modules: $mods
+
+.PHONY: all bad-target inspircd inspircd-bench modules
+
+END
+}
+
+sub run_modules() {
+	my @modlist;
 	foreach my $directory (qw(coremods modules)) {
 		opendir(my $moddir, $directory);
 		for my $file (sort readdir $moddir) {
@@ -110,9 +152,12 @@ END
 				rename "modules/$file", "modules/$file~";
 				symlink "extra/$file", "modules/$file";
 			}
-			if ($file =~ /^(?:core|m)_/ && -d "$directory/$file" && dep_dir "$directory/$file", "modules/$file") {
-				mkdir "${\BUILDPATH}/obj/$file";
-				push @modlist, "modules/$file${\DLL_EXT}";
+			if ($file =~ /^(?:core|m)_/ && -d "$directory/$file") {
+				my @outputs = dep_dir "$directory/$file", "modules/$file";
+				if (@outputs) {
+					mkdir "${\BUILDPATH}/obj/$file";
+					push @modlist, @outputs;
+				}
 			}
 			if ($file =~ /^.*\.cpp$/) {
 				my $out = dep_so "$directory/$file";
@@ -120,30 +165,18 @@ END
 			}
 		}
 	}
-
-	my $core_mk = join ' ', @core_deps;
-	my $mods = join ' ', @modlist;
-	print MAKE <<END;
-
-bin/inspircd: $core_mk
-	@\$(SOURCEPATH)/make/unit-cc.pl core-ld \$\@ \$^ \$>
-
-inspircd: bin/inspircd
-
-modules: $mods
-
-.PHONY: all bad-target inspircd modules
-
-END
+	return @modlist;
 }
 
 sub find_output {
 	my $file = shift;
 	my($path,$base) = $file =~ m#^((?:.*/)?)([^/]+)\.cpp# or die "Bad file $file";
 	if ($path eq 'modules/' || $path eq 'coremods/') {
-		return "modules/$base${\DLL_EXT}";
+		return $ENV{PURE_STATIC} ? "obj/$base.o" : "modules/$base${\DLL_EXT}";
 	} elsif ($path eq '' || $path eq 'modes/' || $path =~ /^[a-z]+engines\/$/) {
 		return "obj/$base.o";
+	} elsif ($path eq 'bench/') {
+		return "obj/bench/$base.o";
 	} elsif ($path =~ m#modules/(m_.*)/# || $path =~ m#coremods/(core_.*)/#) {
 		return "obj/$1/$base.o";
 	} else {
@@ -199,11 +232,11 @@ sub dep_so($) {
 	my($file) = @_;
 	my $out = find_output $file;
 
-	my $name = basename $out, DLL_EXT;
+	my $name = basename $out, DLL_EXT, '.o';
 	print MAKE ".PHONY: $name\n";
 	print MAKE "$name: $out\n";
 
-	dep_cpp $file, $out, 'gen-so';
+	dep_cpp $file, $out, $ENV{PURE_STATIC} ? 'gen-o' : 'gen-so';
 	return $out;
 }
 
@@ -218,16 +251,19 @@ sub dep_dir($$) {
 		push @ofiles, $ofile;
 	}
 	closedir DIR;
-	if (@ofiles) {
-		my $ofiles = join ' ', @ofiles;
-		my $name = basename $outdir;
-		print MAKE ".PHONY: $name\n";
-		print MAKE "$name: $outdir${\DLL_EXT}\n";
-		print MAKE "$outdir${\DLL_EXT}: $ofiles\n";
-		print MAKE "\t@\$(SOURCEPATH)/make/unit-cc.pl link-dir \$\@ ${\SOURCEPATH}/src/$dir \$^ \$>\n";
-		return 1;
-	} else {
-		return 0;
+	return () unless @ofiles;
+
+	my $ofiles = join ' ', @ofiles;
+	my $name = basename $outdir;
+	print MAKE ".PHONY: $name\n";
+	if ($ENV{PURE_STATIC}) {
+		print MAKE "$name: $ofiles\n";
+		return @ofiles;
 	}
+
+	print MAKE "$name: $outdir${\DLL_EXT}\n";
+	print MAKE "$outdir${\DLL_EXT}: $ofiles\n";
+	print MAKE "\t@\$(SOURCEPATH)/make/unit-cc.pl link-dir \$\@ ${\SOURCEPATH}/src/$dir \$^ \$>\n";
+	return "$outdir${\DLL_EXT}";
 }
 
@@ -165,6 +165,10 @@ MISC OPTIONS
                                 the build configuration.
   --gid=[id|name]               Sets the group to run InspIRCd as.
   --help                        Show this message and exit.
+  --monolithic                  Links all modules into the server binary
+                                instead of building them as loadable modules
+                                and enables link-time optimisation. Modules
+                                which are not linked in can not be loaded.
   --socketengine=[name]         Sets the socket engine to be used. Possible
                                 values are $SELIST.
   --uid=[id|name]               Sets the user to run InspIRCd as.
@@ -55,4 +55,7 @@
  /** Whether the clock_gettime() function was available at compile time. */
  %define HAS_CLOCK_GETTIME
 
+ /** Whether the modules are linked into the server binary instead of being loaded at runtime. */
+ %define PURE_STATIC
+
 #endif
@@ -45,6 +45,8 @@ COMPILER = @COMPILER_NAME@
 SYSTEM = @SYSTEM_NAME@
 BUILDPATH ?= $(dir $(realpath $(firstword $(MAKEFILE_LIST))))/build/@COMPILER_NAME@-@COMPILER_VERSION@
 SOCKETENGINE = @SOCKETENGINE@
+PURE_STATIC = @PURE_STATIC|0@
+PROFILEPATH = $(BUILDPATH)/profile
 CORECXXFLAGS = -fPIC -fvisibility=hidden -fvisibility-inlines-hidden -pipe -Iinclude -Ivendor -Wall -Wextra -Wfatal-errors -Wno-unused-parameter -Wshadow
 LDLIBS = -lstdc++
 CORELDFLAGS = -rdynamic -L.
@@ -111,6 +113,31 @@ ifeq ($(SYSTEM), haiku)
   PICLDFLAGS = -fPIC -shared
 endif
 
+ifeq ($(PURE_STATIC), 1)
+  # All of the modules are linked into the core binary so nothing needs to be
+  # exported from it and the optimiser can work across module boundaries.
+  CORECXXFLAGS += -flto
+  CORELDFLAGS := $(filter-out -rdynamic,$(CORELDFLAGS))
+ifeq ($(COMPILER), GCC)
+  CORELDFLAGS += -flto=auto
+else
+  CORELDFLAGS += -flto
+endif
+endif
+
+ifeq ($(INSPIRCD_PROFILE), generate)
+  CORECXXFLAGS += -fprofile-generate=$(PROFILEPATH)
+  CORELDFLAGS += -fprofile-generate=$(PROFILEPATH)
+  PICLDFLAGS += -fprofile-generate=$(PROFILEPATH)
+endif
+ifeq ($(INSPIRCD_PROFILE), use)
+ifeq ($(COMPILER), GCC)
+  CORECXXFLAGS += -fprofile-use=$(PROFILEPATH) -fprofile-partial-training -Wno-missing-profile -Wno-error=coverage-mismatch
+else
+  CORECXXFLAGS += -fprofile-use=$(PROFILEPATH)/inspircd.profdata -Wno-profile-instr-unprofiled -Wno-profile-instr-out-of-date
+endif
+endif
+
 ifndef INSPIRCD_DEBUG
   INSPIRCD_DEBUG=0
 endif
@@ -161,6 +188,7 @@ export CXX
 export INSPIRCD_VERBOSE
 export LDLIBS
 export PICLDFLAGS
+export PURE_STATIC
 export SOCKETENGINE
 export SOURCEPATH
 
@@ -235,7 +263,9 @@ install: target
 	@-$(INSTALL) -d -g @GID@ -o @UID@ -m $(INSTMODE_DIR) $(MODPATH)
 	@-$(INSTALL) -d -g @GID@ -o @UID@ -m $(INSTMODE_DIR) $(SCRPATH)
 	-$(INSTALL) -g @GID@ -o @UID@ -m $(INSTMODE_BIN) "$(BUILDPATH)/bin/inspircd" $(BINPATH)
+ifneq ($(PURE_STATIC), 1)
 	-$(INSTALL) -g @GID@ -o @UID@ -m $(INSTMODE_BIN) "$(BUILDPATH)/modules/"*.$(DLLEXT) $(MODPATH)
+endif
 	-$(INSTALL) -g @GID@ -o @UID@ -m $(INSTMODE_BIN) @CONFIGURE_DIRECTORY@/inspircd $(SCRPATH) 2>/dev/null
 	-$(INSTALL) -g @GID@ -o @UID@ -m $(INSTMODE_TXT) @CONFIGURE_DIRECTORY@/apparmor $(SCRPATH) 2>/dev/null
 	-$(INSTALL) -g @GID@ -o @UID@ -m $(INSTMODE_TXT) @CONFIGURE_DIRECTORY@/logrotate $(SCRPATH) 2>/dev/null
@@ -276,7 +306,7 @@ GNUmakefile: make/template/main.mk src/version.sh configure @CONFIGURE_CACHE_FIL
 
 clean:
 	@echo Cleaning...
-	-rm -f "$(BUILDPATH)/bin/inspircd" "$(BUILDPATH)/include" "$(BUILDPATH)/real.mk"
+	-rm -f "$(BUILDPATH)/bin/inspircd" "$(BUILDPATH)/bin/inspircd-bench" "$(BUILDPATH)/include" "$(BUILDPATH)/real.mk"
 	-rm -rf "$(BUILDPATH)/obj" "$(BUILDPATH)/modules"
 	@-rmdir "$(BUILDPATH)/bin" 2>/dev/null
 	@-rmdir "$(BUILDPATH)" 2>/dev/null
@@ -292,6 +322,27 @@ deinstall:
 	-rm -f $(SCRPATH)/inspircd.service
 	-rm -f $(SCRPATH)/org.inspircd.plist
 
+loadtest:
+	@perl tools/loadtest $(LOADTEST_FLAGS)
+
+bench:
+	@$(MAKE) INSPIRCD_TARGET="inspircd-bench core_serialize_rfc" target
+	"$(BUILDPATH)/bin/inspircd-bench" $(BENCH_FLAGS)
+
+pgo:
+	@echo "Building an instrumented binary ..."
+	@$(MAKE) clean
+	-rm -rf "$(PROFILEPATH)"
+	@$(MAKE) INSPIRCD_PROFILE=generate target
+	@echo "Running the training workload ..."
+	perl tools/pgo-train --binary="$(BUILDPATH)/bin/inspircd" --module-dir="$(BUILDPATH)/modules" $(PGO_TRAIN_FLAGS)
+ifneq ($(COMPILER), GCC)
+	llvm-profdata merge -output="$(PROFILEPATH)/inspircd.profdata" "$(PROFILEPATH)"/*.profraw
+endif
+	@echo "Building an optimised binary using the training profile ..."
+	@$(MAKE) clean
+	@$(MAKE) INSPIRCD_PROFILE=use target
+
 configureclean:
 	-rm -f Makefile
 	rm -f GNUmakefile
@@ -312,6 +363,8 @@ help:
 	@echo ' INSPIRCD_DEBUG=1    Enable debug build, for module development or crash tracing'
 	@echo ' INSPIRCD_DEBUG=2    Enable debug build with optimizations, for detailed backtraces'
 	@echo ' INSPIRCD_DEBUG=3    Enable fast build with no optimisations or symbols (only for CI)'
+	@echo ' INSPIRCD_PROFILE=   Build with profiling instrumentation ("generate") or using'
+	@echo '                     a previously generated profile ("use")'
 	@echo ' DESTDIR=            Specify a destination root directory (for tarball creation)'
 	@echo ' -j <N>              Run a parallel build using N jobs'
 	@echo ''
@@ -327,8 +380,13 @@ help:
 	@echo ' clean     Cleans object files produced by the compile'
 	@echo ' distclean Cleans all generated files (build, configure, run, etc)'
 	@echo ' deinstall Removes the files created by "make install"'
+	@echo ' bench     Builds and runs the core micro-benchmarks, passing them $$BENCH_FLAGS'
+	@echo '           (e.g. "--time=500 match/")'
+	@echo ' loadtest  Runs tools/loadtest against a running server, passing it $$LOADTEST_FLAGS'
+	@echo ' pgo       Builds InspIRCd using a profile generated by running tools/pgo-train,'
+	@echo '           passing it $$PGO_TRAIN_FLAGS. Install it with "make INSPIRCD_PROFILE=use install"'
 	@echo
 
 .NOTPARALLEL:
 
-.PHONY: all target debug debug-header mod-header mod-footer std-header finishmessage install clean deinstall configureclean help
+.PHONY: all target debug debug-header mod-header mod-footer std-header finishmessage install clean deinstall bench loadtest pgo configureclean help
@@ -71,7 +71,17 @@ sub rpath($) {
 }
 
 sub do_core_link {
-	my $execstr = "$ENV{CXX} -o $out $ENV{CORELDFLAGS} @_ $ENV{LDLIBS}";
+	# When building a monolithic binary the modules are linked into the core
+	# binary so it also needs the libraries that they depend on.
+	my $link_flags = '';
+	if ($ENV{PURE_STATIC}) {
+		my %seen;
+		for my $file (<$ENV{SOURCEPATH}/src/{coremods,modules}/{core,m}_*.cpp>, <$ENV{SOURCEPATH}/src/{coremods,modules}/{core,m}_*/*.cpp>) {
+			my $flags = rpath(get_directive($file, 'LinkerFlags', ''));
+			$link_flags .= "$flags " if $flags =~ /\S/ && !$seen{$flags}++;
+		}
+	}
+	my $execstr = "$ENV{CXX} -o $out $ENV{CORELDFLAGS} @_ $link_flags $ENV{LDLIBS}";
 	message 'LINK', $out, $execstr;
 	exec $execstr;
 }
@@ -116,6 +116,7 @@ void* ExtensionItem::SetRaw(Extensible* container, void* value)
 		container->extensions.insert(std::make_pair(this, value));
 	if (rv.second)
 	{
+		count++;
 		return NULL;
 	}
 	else
@@ -133,6 +134,7 @@ void* ExtensionItem::UnsetRaw(Extensible* container)
 		return NULL;
 	void* rv = i->second;
 	container->extensions.erase(i);
+	count--;
 	return rv;
 }
 
@@ -180,6 +182,7 @@ void Extensible::doUnhookExtensions(const std::vector<reference<ExtensionItem> >
 		{
 			item->Delete(this, e->second);
 			extensions.erase(e);
+			item->count--;
 		}
 	}
 }
@@ -201,6 +204,7 @@ void Extensible::FreeAllExtItems()
 	for(ExtensibleStore::iterator i = extensions.begin(); i != extensions.end(); ++i)
 	{
 		i->first->Delete(this, i->second);
+		i->first->count--;
 	}
 	extensions.clear();
 }
@@ -0,0 +1,705 @@
+/*
+ * InspIRCd -- Internet Relay Chat Daemon
+ *
+ * This file is part of InspIRCd.  InspIRCd is free software: you can
+ * redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, version 2.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "inspircd.h"
+#include "xline.h"
+
+/* This is a standalone program which measures the hot core primitives. It is
+ * built with 'make bench' and links against the core objects directly so the
+ * code being measured is the same code that ends up in the server binary.
+ *
+ * A minimal server instance is created without reading a config file or
+ * binding any ports. The RFC serializer is loaded from the modules directory
+ * of the build if it has been built.
+ *
+ * Each benchmark is run for at least the requested time and the average time
+ * and number of heap allocations per operation are reported.
+ */
+
+// These are normally defined alongside main() in inspircd.cpp which is not
+// linked into the benchmarks.
+InspIRCd* ServerInstance = nullptr;
+unsigned const char* national_case_insensitive_map = ascii_case_insensitive_map;
+void InspIRCd::Cleanup() { }
+void InspIRCd::WritePID(bool exitonfail) { }
+
+void InspIRCd::UpdateTime()
+{
+#if defined HAS_CLOCK_GETTIME
+	clock_gettime(CLOCK_REALTIME, &TIME);
+#else
+	TIME.tv_sec = time(NULL);
+	TIME.tv_nsec = 0;
+#endif
+}
+
+InspIRCd::InspIRCd(int argc, char** argv)
+	: PI(&DefaultProtocolInterface)
+	, GenRandom(&DefaultGenRandom)
+	, IsChannel(&DefaultIsChannel)
+	, IsNick(&DefaultIsNick)
+	, IsIdent(&DefaultIsIdent)
+{
+	ServerInstance = this;
+
+	UpdateTime();
+	this->startup_time = TIME.tv_sec;
+
+	this->Config = new ServerConfig;
+	dynamic_reference_base::reset_all();
+	this->XLines = new XLineManager;
+
+	this->Config->cmdline.argv = argv;
+	this->Config->cmdline.argc = argc;
+	this->Config->ServerName = "bench.example.com";
+	this->Config->ServerDesc = "Benchmark server";
+	this->Config->sid = "001";
+
+	// Modules are loaded from the build directory that the benchmarks are in.
+	const std::string self = argv[0];
+	const std::string::size_type slash = self.rfind('/');
+	this->Config->Paths.Module = (slash == std::string::npos ? std::string(".") : self.substr(0, slash)) + "/../modules";
+
+	this->UIDGen.init(Config->sid);
+	this->FakeClient = new FakeUser(Config->sid, Config->ServerName, Config->ServerDesc);
+}
+
+namespace
+{
+	/** The number of heap allocations which have been made since startup. */
+	size_t allocations = 0;
+
+	/** Stops the compiler from optimising away or hoisting the work of a benchmark. */
+	template<typename T>
+	void KeepAlive(T& value)
+	{
+#if defined __GNUC__ || defined __clang__
+		asm volatile("" : : "r"(&value) : "memory");
+#else
+		static const void* volatile sink;
+		sink = &value;
+		std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+	}
+
+	/** Owns the extensions and other objects which the benchmarks need a module for. */
+	class BenchModule final
+		: public Module
+	{
+	 public:
+		BenchModule()
+			: Module(VF_VENDOR, "Provides the objects used by the benchmarks")
+		{
+		}
+	};
+
+	/** A module which does a minimal amount of work for each event dispatched to it. */
+	class DispatchModule final
+		: public Module
+	{
+	 public:
+		size_t calls = 0;
+
+		DispatchModule()
+			: Module(VF_VENDOR, "Receives the events dispatched by the benchmarks")
+		{
+		}
+
+		void OnBackgroundTimer(time_t) override
+		{
+			calls++;
+		}
+
+		ModResult OnUserPreNick(LocalUser*, const std::string&) override
+		{
+			calls++;
+			return MOD_RES_PASSTHRU;
+		}
+	};
+
+	/** A timer which never fires during a benchmark. */
+	class BenchTimer final
+		: public Timer
+	{
+	 public:
+		BenchTimer(unsigned int secs_from_now)
+			: Timer(secs_from_now)
+		{
+		}
+
+		bool Tick(time_t) override
+		{
+			return false;
+		}
+	};
+
+	/** The state which is shared between benchmarks. It is never destroyed. */
+	struct Fixture final
+	{
+		BenchModule module;
+		IntExtItem intext;
+		StringExtItem stringext;
+		std::vector<std::unique_ptr<IntExtItem>> otherexts;
+		std::vector<std::unique_ptr<BenchTimer>> timers;
+		std::vector<std::unique_ptr<DispatchModule>> dispatchmodules;
+		LocalUser* user;
+
+		Fixture()
+			: intext(&module, "bench-int", ExtensionItem::EXT_USER)
+			, stringext(&module, "bench-string", ExtensionItem::EXT_USER)
+		{
+			irc::sockets::sockaddrs client;
+			irc::sockets::aptosa("192.0.2.55", 6697, client);
+			irc::sockets::sockaddrs server;
+			irc::sockets::aptosa("192.0.2.1", 6667, server);
+			user = new LocalUser(-1, &client, &server);
+			user->nick = "BenchUser";
+			user->ident = "bench";
+			FOREACH_MOD(OnUserInit, (user));
+
+			// Users usually have a handful of extensions set by modules.
+			for (size_t i = 0; i < 8; ++i)
+			{
+				otherexts.push_back(std::make_unique<IntExtItem>(&module, "bench-other-" + ConvToStr(i), ExtensionItem::EXT_USER));
+				otherexts.back()->set(user, i + 1);
+			}
+			intext.set(user, 1);
+			stringext.set(user, "value");
+
+			// These are attached to events by the dispatch benchmarks.
+			for (size_t i = 0; i < 50; ++i)
+				dispatchmodules.push_back(std::make_unique<DispatchModule>());
+
+			// A server with many users has a timer pending for each of them.
+			for (unsigned int i = 0; i < 1000; ++i)
+			{
+				timers.push_back(std::make_unique<BenchTimer>(1 + i % 300));
+				ServerInstance->Timers.AddTimer(timers.back().get());
+			}
+
+			for (size_t i = 0; i < 10000; ++i)
+				ServerInstance->BanCache.AddHit(InspIRCd::Format("198.51.%zu.%zu", i / 256, i % 256), i % 10 ? "" : "Z", i % 10 ? "" : "Z-lined: Benchmark", 3600);
+
+			for (size_t i = 0; i < 1000; ++i)
+			{
+				XLine* zline = new ZLine(ServerInstance->Time(), 0, "bench", "Benchmark", InspIRCd::Format("10.%zu.%zu.0/24", i / 256, i % 256));
+				if (!ServerInstance->XLines->AddLine(zline, nullptr))
+					delete zline;
+
+				XLine* gline = new GLine(ServerInstance->Time(), 0, "bench", "Benchmark", "*", InspIRCd::Format("*.host-%zu.example.com", i));
+				if (!ServerInstance->XLines->AddLine(gline, nullptr))
+					delete gline;
+			}
+		}
+	};
+
+	Fixture* fixture = nullptr;
+
+	/** Runs a benchmark for the specified number of iterations and returns a value which depends on its work. */
+	typedef size_t (*BenchmarkFunc)(size_t iterations);
+
+	size_t MatchLiteral(size_t iterations)
+	{
+		std::string str = "irc.example.com";
+		std::string mask = "IRC.example.com";
+		size_t matches = 0;
+		for (size_t i = 0; i < iterations; ++i)
+		{
+			KeepAlive(str);
+			matches += InspIRCd::Match(str, mask);
+		}
+		return matches;
+	}
+
+	size_t MatchWildcard(size_t iterations)
+	{
+		std::string str = "Nick!ident@host-123.dynamic.example.com";
+		std::string mask = "*!*@*.EXAMPLE.com";
+		size_t matches = 0;
+		for (size_t i = 0; i < iterations; ++i)
+		{
+			KeepAlive(str);
+			matches += InspIRCd::Match(str, mask);
+		}
+		return matches;
+	}
+
+	size_t MatchMiss(size_t iterations)
+	{
+		std::string str = "Nick!ident@host-123.dynamic.example.net";
+		std::string mask = "*!*@*.example.com";
+		size_t matches = 0;
+		for (size_t i = 0; i < iterations; ++i)
+		{
+			KeepAlive(str);
+			matches += InspIRCd::Match(str, mask);
+		}
+		return matches;
+	}
+
+	size_t MatchCIDR(size_t iterations)
+	{
+		std::string str = "192.0.2.55";
+		std::string mask = "192.0.2.0/24";
+		size_t matches = 0;
+		for (size_t i = 0; i < iterations; ++i)
+		{
+			KeepAlive(str);
+			matches += InspIRCd::MatchCIDR(str, mask);
+		}
+		return matches;
+	}
+
+	size_t MatchCIDRFallback(size_t iterations)
+	{
+		std::string str = "host-123.dynamic.example.com";
+		std::string mask = "*.example.com";
+		size_t matches = 0;
+		for (size_t i = 0; i < iterations; ++i)
+		{
+			KeepAlive(str);
+			matches += InspIRCd::MatchCIDR(str, mask);
+		}
+		return matches;
+	}
+
+	size_t TokenStream(size_t iterations)
+	{
+		std::string line = "PRIVMSG #channel :Hello world, this is a fairly typical message.";
+		std::string token;
+		size_t tokens = 0;
+		for (size_t i = 0; i < iterations; ++i)
+		{
+			KeepAlive(line);
+			irc::tokenstream stream(line);
+			stream.GetMiddle(token);
+			while (stream.GetTrailing(token))
+				tokens++;
+		}
+		return tokens;
+	}
+
+	size_t TokenStreamMiddle(size_t iterations)
+	{
+		std::string line = "MODE #channel +ooov nick1 nick2 nick3 nick4";
+		std::string token;
+		size_t tokens = 0;
+		for (size_t i = 0; i < iterations; ++i)
+		{
+			KeepAlive(line);
+			irc::tokenstream stream(line);
+			stream.GetMiddle(token);
+			while (stream.GetTrailing(token))
+				tokens++;
+		}
+		return tokens;
+	}
+
+	size_t InsensitiveHash(size_t iterations)
+	{
+		std::string nick = "SomeFairlyLongNick";
+		size_t hash = 0;
+		for (size_t i = 0; i < iterations; ++i)
+		{
+			KeepAlive(nick);
+			hash += irc::insensitive()(nick);
+		}
+		return hash;
+	}
+
+	size_t InsensitiveEquals(size_t iterations)
+	{
+		std::string first = "SomeFairlyLongNick";
+		std::string second = "somefairlylongNICK";
+		size_t matches = 0;
+		for (size_t i = 0; i < iterations; ++i)
+		{
+			KeepAlive(first);
+			matches += irc::equals(first, second);
+		}
+		return matches;
+	}
+
+	size_t NickLookup(size_t iterations)
+	{
+		// These are only built once so that they are not included in the timings.
+		static const user_hash users = [] {
+			user_hash result;
+			for (size_t i = 0; i < 10000; ++i)
+				result.emplace("Nick" + ConvToStr(i), nullptr);
+			return result;
+		}();
+		static std::vector<std::string> nicks = [] {
+			std::vector<std::string> result;
+			for (size_t i = 0; i < 64; ++i)
+				result.push_back("NICK" + ConvToStr(i * 151 % 10000));
+			return result;
+		}();
+
+		size_t found = 0;
+		for (size_t i = 0; i < iterations; ++i)
+		{
+			std::string& nick = nicks[i % nicks.size()];
+			KeepAlive(nick);
+			found += users.count(nick);
+		}
+		return found;
+	}
+
+	size_t UUIDLookup(size_t iterations)
+	{
+		// A large server has many UUIDs which only differ in their last few characters.
+		static std::vector<std::string> uuids;
+		static const user_hash users = [] {
+			user_hash result;
+			for (size_t i = 0; i < 100000; ++i)
+			{
+				const std::string uuid = ServerInstance->UIDGen.GetUID();
+				result.emplace(uuid, nullptr);
+				if (i % 1543 == 0)
+					uuids.push_back(uuid);
+			}
+			return result;
+		}();
+
+		size_t found = 0;
+		for (size_t i = 0; i < iterations; ++i)
+		{
+			std::string& uuid = uuids[i % uuids.size()];
+			KeepAlive(uuid);
+			found += users.count(uuid);
+		}
+		return found;
+	}
+
+	size_t SerializerParse(size_t iterations)
+	{
+		const std::string line = "@+draft/reply=abc PRIVMSG #channel :Hello world, this is a fairly typical message.";
+		ClientProtocol::ParseOutput parseoutput;
+		size_t params = 0;
+		for (size_t i = 0; i < iterations; ++i)
+		{
+			KeepAlive(line);
+			parseoutput.cmd.clear();
+			parseoutput.params.clear();
+			parseoutput.tags.clear();
+			if (fixture->user->serializer->Parse(fixture->user, line, parseoutput))
+				params += parseoutput.params.size();
+		}
+		return params;
+	}
+
+	ClientProtocol::Message& MakeMessage()
+	{
+		// The message only keeps a pointer to its source so it has to outlive the message.
+		static const std::string source = "Nick!ident@host-123.dynamic.example.com";
+		static ClientProtocol::Message msg("PRIVMSG", source);
+		if (msg.GetParams().empty())
+		{
+			msg.PushParam("#channel");
+			msg.PushParam("Hello world, this is a fairly typical message.");
+		}
+		return msg;
+	}
+
+	size_t SerializerSerialize(size_t iterations)
+	{
+		const ClientProtocol::Message& msg = MakeMessage();
+		const ClientProtocol::TagSelection tagwl;
+		size_t bytes = 0;
+		for (size_t i = 0; i < iterations; ++i)
+		{
+			KeepAlive(msg);
+			bytes += fixture->user->serializer->Serialize(msg, tagwl).length();
+		}
+		return bytes;
+	}
+
+	size_t GetSerialized(size_t iterations)
+	{
+		ClientProtocol::Message& msg = MakeMessage();
+		const ClientProtocol::Message::SerializedInfo info(fixture->user->serializer, ClientProtocol::TagSelection());
+		size_t bytes = 0;
+		for (size_t i = 0; i < iterations; ++i)
+		{
+			msg.InvalidateCache();
+			bytes += msg.GetSerialized(info).length();
+		}
+		return bytes;
+	}
+
+	size_t GetSerializedCached(size_t iterations)
+	{
+		ClientProtocol::Message& msg = MakeMessage();
+		const ClientProtocol::Message::SerializedInfo info(fixture->user->serializer, ClientProtocol::TagSelection());
+		msg.InvalidateCache();
+		size_t bytes = 0;
+		for (size_t i = 0; i < iterations; ++i)
+		{
+			KeepAlive(msg);
+			bytes += msg.GetSerialized(info).length();
+		}
+		return bytes;
+	}
+
+	size_t ExtensibleGet(size_t iterations)
+	{
+		size_t total = 0;
+		for (size_t i = 0; i < iterations; ++i)
+		{
+			KeepAlive(*fixture->user);
+			total += fixture->intext.get(fixture->user);
+		}
+		return total;
+	}
+
+	size_t ExtensibleSetInt(size_t iterations)
+	{
+		for (size_t i = 0; i < iterations; ++i)
+			fixture->intext.set(fixture->user, i + 1);
+		return fixture->intext.get(fixture->user);
+	}
+
+	size_t ExtensibleSetString(size_t iterations)
+	{
+		const std::string value = "value";
+		for (size_t i = 0; i < iterations; ++i)
+		{
+			KeepAlive(value);
+			fixture->stringext.set(fixture->user, value);
+		}
+		return fixture->stringext.get(fixture->user)->length();
+	}
+
+	size_t TimerAddDel(size_t iterations)
+	{
+		BenchTimer timer(150);
+		for (size_t i = 0; i < iterations; ++i)
+		{
+			ServerInstance->Timers.AddTimer(&timer);
+			ServerInstance->Timers.DelTimer(&timer);
+		}
+		return iterations;
+	}
+
+	size_t BanCacheHit(size_t iterations)
+	{
+		static std::vector<std::string> ips = [] {
+			std::vector<std::string> result;
+			for (size_t i = 0; i < 64; ++i)
+			{
+				const size_t idx = i * 151 % 10000;
+				result.push_back(InspIRCd::Format("198.51.%zu.%zu", idx / 256, idx % 256));
+			}
+			return result;
+		}();
+
+		size_t found = 0;
+		for (size_t i = 0; i < iterations; ++i)
+		{
+			std::string& ip = ips[i % ips.size()];
+			KeepAlive(ip);
+			found += !!ServerInstance->BanCache.GetHit(ip);
+		}
+		return found;
+	}
+
+	size_t BanCacheMiss(size_t iterations)
+	{
+		std::string ip = "203.0.113.55";
+		size_t found = 0;
+		for (size_t i = 0; i < iterations; ++i)
+		{
+			KeepAlive(ip);
+			found += !!ServerInstance->BanCache.GetHit(ip);
+		}
+		return found;
+	}
+
+	size_t XLineMatchIP(size_t iterations)
+	{
+		std::string ip = "192.0.2.55";
+		size_t found = 0;
+		for (size_t i = 0; i < iterations; ++i)
+		{
+			KeepAlive(ip);
+			found += !!ServerInstance->XLines->MatchesLine("Z", ip);
+		}
+		return found;
+	}
+
+	size_t XLineMatchUser(size_t iterations)
+	{
+		size_t found = 0;
+		for (size_t i = 0; i < iterations; ++i)
+		{
+			KeepAlive(*fixture->user);
+			found += !!ServerInstance->XLines->MatchesLine("G", fixture->user);
+		}
+		return found;
+	}
+
+	/** Attaches the specified number of modules to an event which nothing else handles. */
+	void AttachDispatchModules(Implementation event, size_t count)
+	{
+		Module::List& handlers = ServerInstance->Modules.EventHandlers[event];
+		handlers.clear();
+		for (size_t i = 0; i < count; ++i)
+			handlers.push_back(fixture->dispatchmodules[i].get());
+	}
+
+	template <size_t Modules>
+	size_t DispatchForEach(size_t iterations)
+	{
+		AttachDispatchModules(I_OnBackgroundTimer, Modules);
+		for (size_t i = 0; i < iterations; ++i)
+			FOREACH_MOD(OnBackgroundTimer, (static_cast<time_t>(i)));
+		return Modules ? fixture->dispatchmodules[0]->calls : iterations;
+	}
+
+	template <size_t Modules>
+	size_t DispatchFirstResult(size_t iterations)
+	{
+		AttachDispatchModules(I_OnUserPreNick, Modules);
+		std::string newnick = "BenchNick";
+		size_t denied = 0;
+		for (size_t i = 0; i < iterations; ++i)
+		{
+			KeepAlive(newnick);
+			ModResult res;
+			FIRST_MOD_RESULT(OnUserPreNick, res, (fixture->user, newnick));
+			denied += res == MOD_RES_DENY;
+		}
+		return denied;
+	}
+
+	struct Benchmark final
+	{
+		const char* name;
+		BenchmarkFunc func;
+		bool needserializer = false;
+	};
+
+	const Benchmark benchmarks[] = {
+		{ "match/literal", MatchLiteral },
+		{ "match/wildcard", MatchWildcard },
+		{ "match/miss", MatchMiss },
+		{ "matchcidr/ipv4", MatchCIDR },
+		{ "matchcidr/fallback", MatchCIDRFallback },
+		{ "tokenstream/trailing", TokenStream },
+		{ "tokenstream/middle", TokenStreamMiddle },
+		{ "insensitive/hash", InsensitiveHash },
+		{ "insensitive/equals", InsensitiveEquals },
+		{ "insensitive/nicklookup", NickLookup },
+		{ "insensitive/uuidlookup", UUIDLookup },
+		{ "serializer/parse", SerializerParse, true },
+		{ "serializer/serialize", SerializerSerialize, true },
+		{ "message/getserialized", GetSerialized, true },
+		{ "message/getserialized-cached", GetSerializedCached, true },
+		{ "extensible/get", ExtensibleGet },
+		{ "extensible/set-int", ExtensibleSetInt },
+		{ "extensible/set-string", ExtensibleSetString },
+		{ "timer/add-del", TimerAddDel },
+		{ "bancache/hit", BanCacheHit },
+		{ "bancache/miss", BanCacheMiss },
+		{ "xline/zline-ip", XLineMatchIP },
+		{ "xline/gline-user", XLineMatchUser },
+		{ "dispatch/foreach-0", DispatchForEach<0> },
+		{ "dispatch/foreach-10", DispatchForEach<10> },
+		{ "dispatch/foreach-50", DispatchForEach<50> },
+		{ "dispatch/firstresult-0", DispatchFirstResult<0> },
+		{ "dispatch/firstresult-10", DispatchFirstResult<10> },
+		{ "dispatch/firstresult-50", DispatchFirstResult<50> },
+	};
+
+	void Run(const Benchmark& benchmark, std::chrono::nanoseconds mintime)
+	{
+		// Double the number of iterations until the benchmark runs for long
+		// enough to give a stable result.
+		for (size_t iterations = 1000; ; iterations *= 2)
+		{
+			const size_t startallocs = allocations;
+			const auto start = std::chrono::steady_clock::now();
+			volatile size_t result = benchmark.func(iterations);
+			const auto elapsed = std::chrono::steady_clock::now() - start;
+			(void)result;
+
+			if (elapsed < mintime)
+				continue;
+
+			const double nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+			printf("%-28s %12zu %12.1f ns/op %10.2f allocs/op\n", benchmark.name, iterations,
+				nanos / iterations, double(allocations - startallocs) / iterations);
+			return;
+		}
+	}
+}
+
+void* operator new(size_t size)
+{
+	allocations++;
+	void* ptr = malloc(size ? size : 1);
+	if (!ptr)
+		throw std::bad_alloc();
+	return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+	free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+	free(ptr);
+}
+
+ENTRYPOINT
+{
+	// Usage: inspircd-bench [--time=<milliseconds>] [<name prefix>]...
+	std::chrono::nanoseconds mintime = std::chrono::milliseconds(250);
+	std::vector<std::string> filters;
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string arg = argv[i];
+		if (!arg.compare(0, 7, "--time="))
+			mintime = std::chrono::milliseconds(ConvToNum<unsigned long>(arg.substr(7)));
+		else
+			filters.push_back(arg);
+	}
+
+	new InspIRCd(argc, argv);
+	if (!ServerInstance->Modules.Load("core_serialize_rfc"))
+		printf("Unable to load the RFC serializer, skipping the serializer benchmarks: %s\n\n", ServerInstance->Modules.LastError().c_str());
+	fixture = new Fixture;
+
+	printf("%-28s %12s %18s %20s\n", "benchmark", "iterations", "time", "allocations");
+	for (const auto& benchmark : benchmarks)
+	{
+		const std::string name = benchmark.name;
+		if (!filters.empty() && std::none_of(filters.begin(), filters.end(), [&name](const std::string& filter) {
+			return !name.compare(0, filter.length(), filter);
+		}))
+			continue;
+
+		if (benchmark.needserializer && !fixture->user->serializer)
+			continue;
+
+		Run(benchmark, mintime);
+	}
+	return EXIT_SUCCESS;
+}
@@ -27,10 +27,12 @@
 
 #include "inspircd.h"
 #include "listmode.h"
+#include "modules/extban.h"
 
 namespace
 {
 	ChanModeReference ban(NULL, "ban");
+	ExtBan::ManagerRef extbanmgr(NULL);
 }
 
 Channel::Channel(const std::string &cname, time_t ts)
@@ -44,7 +46,13 @@ Channel::Channel(const std::string &cname, time_t ts)
 void Channel::SetMode(ModeHandler* mh, bool on)
 {
 	if (mh && mh->GetId() != ModeParser::MODEID_MAX)
+	{
 		modes[mh->GetId()] = on;
+
+		// Parameter modes are set again when only their parameter changes so
+		// this has to be invalidated even if the bit did not change.
+		InvalidateModeCache();
+	}
 }
 
 void Channel::SetTopic(User* u, const std::string& ntopic, time_t topicts, const std::string* setter)
@@ -73,6 +81,7 @@ Membership* Channel::AddUser(User* user)
 		return NULL;
 
 	Membership* memb = new(ret.first->second) Membership(user, this);
+	memberserial++;
 	return memb;
 }
 
@@ -109,6 +118,7 @@ void Channel::DelUser(const MemberMap::iterator& membiter)
 	memb->cull();
 	memb->~Membership();
 	userlist.erase(membiter);
+	memberserial++;
 
 	// If this channel became empty then it should be removed
 	CheckDestroy();
@@ -294,6 +304,10 @@ bool Channel::IsBanned(User* user)
 	if (!banlm)
 		return false;
 
+	// The extban manager indexes the ban list so not every entry has to be checked.
+	if (extbanmgr)
+		return extbanmgr->FindMatches(banlm, user, this);
+
 	const ListModeBase::ModeList* bans = banlm->GetList(this);
 	if (bans)
 	{
@@ -392,39 +406,46 @@ void Channel::Write(ClientProtocol::Event& protoev, char status, const CUList& e
 	}
 }
 
-const char* Channel::ChanModes(bool showsecret)
+const Channel::ModeList& Channel::GetModeList(bool showsecret)
 {
-	static std::string scratch;
-	std::string sparam;
-
-	scratch.clear();
+	ModeList& cache = modecache[showsecret];
+	if (modecachevalid[showsecret])
+		return cache;
 
-	/* This was still iterating up to 190, Channel::modes is only 64 elements -- Om */
-	for(int n = 0; n < 64; n++)
+	cache.letters.clear();
+	cache.params.clear();
+	if (modes.any())
 	{
-		ModeHandler* mh = ServerInstance->Modes.FindMode(n + 65, MODETYPE_CHANNEL);
-		if (mh && IsModeSet(mh))
+		/* This was still iterating up to 190, Channel::modes is only 64 elements -- Om */
+		for(int n = 0; n < 64; n++)
 		{
-			scratch.push_back(n + 65);
+			ModeHandler* mh = ServerInstance->Modes.FindMode(n + 65, MODETYPE_CHANNEL);
+			if (mh && IsModeSet(mh))
+			{
+				cache.letters.push_back(n + 65);
 
-			ParamModeBase* pm = mh->IsParameterMode();
-			if (!pm)
-				continue;
+				ParamModeBase* pm = mh->IsParameterMode();
+				if (!pm)
+					continue;
 
-			if (pm->IsParameterSecret() && !showsecret)
-			{
-				sparam += " <" + pm->name + ">";
-			}
-			else
-			{
-				sparam += ' ';
-				pm->GetParameter(this, sparam);
+				if (pm->IsParameterSecret() && !showsecret)
+				{
+					cache.params.push_back("<" + pm->name + ">");
+				}
+				else
+				{
+					cache.params.emplace_back();
+					pm->GetParameter(this, cache.params.back());
+				}
 			}
 		}
 	}
 
-	scratch += sparam;
-	return scratch.c_str();
+	cache.str = cache.letters;
+	for (const auto& param : cache.params)
+		cache.str.append(1, ' ').append(param);
+	modecachevalid[showsecret] = true;
+	return cache;
 }
 
 void Channel::WriteNotice(const std::string& text, char status)
@@ -496,6 +517,7 @@ unsigned int Channel::GetPrefixValue(User* user)
 
 bool Membership::SetPrefix(PrefixMode* delta_mh, bool adding)
 {
+	chan->memberserial++;
 	char prefix = delta_mh->GetModeChar();
 	for (unsigned int i = 0; i < modes.length(); i++)
 	{
@@ -25,6 +25,15 @@
 
 #include "inspircd.h"
 
+/* Checks whether a mask (without a username part) is textually a valid CIDR range. */
+static bool IsCIDR(const std::string& mask)
+{
+	const std::string::size_type per_pos = mask.rfind('/');
+	return (per_pos != std::string::npos) && (per_pos != mask.length()-1)
+		&& (mask.find_first_not_of("0123456789", per_pos+1) == std::string::npos)
+		&& (mask.find_first_not_of("0123456789abcdefABCDEF.:") >= per_pos);
+}
+
 /* Match CIDR strings, e.g. 127.0.0.1 to 127.0.0.0/8 or 3ffe:1:5:6::8 to 3ffe:1::0/32
  *
  * This will also attempt to match any leading usernames or nicknames on the mask, using
@@ -67,10 +76,7 @@ bool irc::sockets::MatchCIDR(const std::string &address, const std::string &cidr
 		cidr_copy.assign(cidr_mask);
 	}
 
-	const std::string::size_type per_pos = cidr_copy.rfind('/');
-	if ((per_pos == std::string::npos) || (per_pos == cidr_copy.length()-1)
-		|| (cidr_copy.find_first_not_of("0123456789", per_pos+1) != std::string::npos)
-		|| (cidr_copy.find_first_not_of("0123456789abcdefABCDEF.:") < per_pos))
+	if (!IsCIDR(cidr_copy))
 	{
 		// The CIDR mask is invalid
 		return false;
@@ -88,3 +94,26 @@ bool irc::sockets::MatchCIDR(const std::string &address, const std::string &cidr
 
 	return mask == mask2;
 }
+
+irc::sockets::address_mask::address_mask(const std::string& m)
+	: mask(m)
+{
+	if (!IsCIDR(mask))
+		return;
+
+	irc::sockets::sockaddrs sa;
+	if (!irc::sockets::aptosa(mask.substr(0, mask.rfind('/')), 0, sa))
+		return;
+
+	iscidr = true;
+	cidr = irc::sockets::cidr_mask(mask);
+}
+
+bool irc::sockets::address_mask::match(const irc::sockets::sockaddrs& addr, const std::string& addrstr) const
+{
+	// A CIDR range can never match as a glob pattern as addresses do not contain a slash.
+	if (iscidr)
+		return cidr.match(addr);
+
+	return InspIRCd::Match(addrstr, mask, ascii_case_insensitive_map);
+}
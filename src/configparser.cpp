@@ -429,7 +429,23 @@ void ParseStack::DoReadFile(const std::string& key, const std::string& name, int
 		throw CoreException("Invalid <execfiles> tag in file included with noexec=\"yes\"");
 
 	std::string path = ServerInstance->Config->Paths.PrependConfig(name);
-	FileWrapper file(exec ? popen(name.c_str(), "r") : fopen(path.c_str(), "r"), exec);
+	if (!exec)
+	{
+		// Regular files are read through the file cache so they are only read again if they have changed.
+		try
+		{
+			FileReader reader;
+			reader.LoadFromDisk(name);
+			FilesOutput[key] = reader.GetVector();
+			return;
+		}
+		catch (const CoreException&)
+		{
+			throw CoreException("Could not read \"" + path + "\" for \"" + key + "\" file");
+		}
+	}
+
+	FileWrapper file(popen(name.c_str(), "r"), exec);
 	if (!file)
 		throw CoreException("Could not read \"" + path + "\" for \"" + key + "\" file");
 
@@ -359,6 +359,9 @@ void ServerConfig::Fill()
 	CCOnConnect = ConfValue("performance")->getBool("clonesonconnect", true);
 	MaxConn = ConfValue("performance")->getUInt("somaxconn", SOMAXCONN);
 	TimeSkipWarn = ConfValue("performance")->getDuration("timeskipwarn", 2, 0, 30);
+	SendQBudget = ConfValue("performance")->getUInt("sendqbudget", 0);
+	StartupThreads = ConfValue("performance")->getUInt("startupthreads", 0, 0, 256);
+	Module::UsageTimer::enabled = ConfValue("performance")->getBool("moduletiming", false);
 	XLineMessage = options->getString("xlinemessage", "You're banned!", 1);
 	ServerDesc = server->getString("description", "Configure Me", 1);
 	Network = server->getString("network", "Network", 1);
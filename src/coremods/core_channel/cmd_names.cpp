@@ -28,7 +28,6 @@
 
 #include "inspircd.h"
 #include "core_channel.h"
-#include "modules/names.h"
 
 CommandNames::CommandNames(Module* parent)
 	: SplitCommand(parent, "NAMES", 0, 0)
@@ -36,6 +35,7 @@ CommandNames::CommandNames(Module* parent)
 	, privatemode(parent, "private")
 	, invisiblemode(parent, "invisible")
 	, namesevprov(parent, "event/names")
+	, namescache(parent, "names-cache", ExtensionItem::EXT_CHANNEL)
 {
 	syntax = { "[<channel>[,<channel>]+]" };
 }
@@ -76,17 +76,85 @@ CmdResult CommandNames::HandleLocal(LocalUser* user, const Params& parameters)
 	return CmdResult::FAILURE;
 }
 
+const std::vector<std::string>& CommandNames::GetCachedNames(Channel* chan, unsigned int format)
+{
+	NamesCache* cache = namescache.get(chan);
+	if (!cache || cache->serial != chan->memberserial)
+	{
+		cache = new NamesCache(chan->memberserial);
+		namescache.set(chan, cache);
+	}
+
+	std::vector<std::string>& lines = cache->lines[format];
+	if (!lines.empty())
+		return lines;
+
+	// This is the same limit as Numeric::Builder uses except that we leave room for the longest
+	// possible nick instead of the nick of a specific user.
+	const size_t maxline = ServerInstance->Config->Limits.MaxLine - ServerInstance->Config->GetServerName().size()
+		- ServerInstance->Config->Limits.MaxNick - (chan->name.size() + 3) - 10;
+
+	std::string line;
+	std::string prefixes;
+	const Channel::MemberMap& members = chan->GetUsers();
+	for (Channel::MemberMap::const_iterator i = members.begin(); i != members.end(); ++i)
+	{
+		Membership* const memb = i->second;
+
+		prefixes.clear();
+		if (format & Names::FORMAT_ALL_PREFIXES)
+			prefixes = memb->GetAllPrefixChars();
+		else if (memb->GetPrefixChar())
+			prefixes.push_back(memb->GetPrefixChar());
+
+		const std::string& nick = (format & Names::FORMAT_USERHOST) ? i->first->GetFullHost() : i->first->nick;
+
+		if (!line.empty() && line.size() + prefixes.size() + nick.size() + 1 > maxline)
+		{
+			lines.push_back(line);
+			line.clear();
+		}
+
+		if (!line.empty())
+			line.push_back(' ');
+		line.append(prefixes).append(nick);
+	}
+
+	if (!line.empty())
+		lines.push_back(line);
+	return lines;
+}
+
 void CommandNames::SendNames(LocalUser* user, Channel* chan, bool show_invisible)
 {
-	Numeric::Builder<' '> reply(user, RPL_NAMREPLY, false, chan->name.size() + 3);
-	Numeric::Numeric& numeric = reply.GetNumeric();
+	std::string symbol;
 	if (chan->IsModeSet(secretmode))
-		numeric.push(std::string(1, '@'));
+		symbol.push_back('@');
 	else if (chan->IsModeSet(privatemode))
-		numeric.push(std::string(1, '*'));
+		symbol.push_back('*');
 	else
-		numeric.push(std::string(1, '='));
+		symbol.push_back('=');
 
+	// Members of a channel (and opers with channels/auspex) see every member so unless a module needs to
+	// filter or rewrite the entries on a per-user basis the list can be sent from the cache.
+	unsigned int format = 0;
+	if (show_invisible && namesevprov.FirstResult(&Names::EventListener::OnNamesListPrepare, user, chan, format) != MOD_RES_DENY)
+	{
+		for (const auto& line : GetCachedNames(chan, format))
+		{
+			Numeric::Numeric numeric(RPL_NAMREPLY);
+			numeric.push(symbol);
+			numeric.push(chan->name);
+			numeric.push(line);
+			user->WriteNumeric(numeric);
+		}
+		user->WriteNumeric(RPL_ENDOFNAMES, chan->name, "End of /NAMES list.");
+		return;
+	}
+
+	Numeric::Builder<' '> reply(user, RPL_NAMREPLY, false, chan->name.size() + 3);
+	Numeric::Numeric& numeric = reply.GetNumeric();
+	numeric.push(symbol);
 	numeric.push(chan->name);
 	numeric.push(std::string());
 
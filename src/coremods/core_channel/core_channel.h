@@ -24,6 +24,7 @@
 #include "listmode.h"
 #include "modules/exemption.h"
 #include "modules/extban.h"
+#include "modules/names.h"
 
 namespace Topic
 {
@@ -119,6 +120,22 @@ class CommandTopic : public SplitCommand
 	CmdResult HandleLocal(LocalUser* user, const Params& parameters) override;
 };
 
+/** Holds the pre-rendered NAMES list of a channel as seen by its members.
+ */
+struct NamesCache
+{
+	/** The value of Channel::memberserial when this cache was rendered. */
+	unsigned long serial;
+
+	/** The NAMES reply lines for each combination of Names::Format flags. Empty if not rendered yet. */
+	std::vector<std::string> lines[Names::FORMAT_COUNT];
+
+	NamesCache(unsigned long s)
+		: serial(s)
+	{
+	}
+};
+
 /** Handle /NAMES.
  */
 class CommandNames : public SplitCommand
@@ -128,6 +145,14 @@ class CommandNames : public SplitCommand
 	ChanModeReference privatemode;
 	UserModeReference invisiblemode;
 	Events::ModuleEventProvider namesevprov;
+	SimpleExtItem<NamesCache> namescache;
+
+	/** Retrieves the cached NAMES reply lines for a channel, rendering them if necessary.
+	 * @param chan The channel to retrieve the NAMES reply lines for.
+	 * @param format A bitmask of values from Names::Format which the lines should be formatted with.
+	 * @return The NAMES reply lines for the channel.
+	 */
+	const std::vector<std::string>& GetCachedNames(Channel* chan, unsigned int format);
 
  public:
 	/** Constructor for names.
@@ -228,19 +253,58 @@ class ModeChannelVoice : public PrefixMode
 	}
 };
 
+/** An index of the entries in the list of a list mode on a channel. */
+struct ExtBanIndex
+{
+	/** A mapping of extban values to the position of the entries which contain them. */
+	typedef std::unordered_multimap<std::string, size_t, irc::insensitive, irc::StrHashComp> KeyMap;
+
+	/** The entries for either a single acting extban or for no acting extban. */
+	struct Group
+	{
+		/** Entries for matching extbans which can be found by the match key of a user. */
+		insp::flat_map<ExtBan::MatchingBase*, KeyMap> keyed;
+
+		/** Entries which have to be checked one by one. */
+		std::vector<size_t> others;
+	};
+
+	/** The serial of the list when this index was built. */
+	unsigned long listserial = 0;
+
+	/** The serial of the extban manager when this index was built. */
+	unsigned long extbanserial = 0;
+
+	/** The indexed entries grouped by the acting extban they are for. */
+	insp::flat_map<ExtBan::Acting*, Group> groups;
+};
+
 class ExtBanManager : public ExtBan::Manager
 {
  private:
+	// This needs to be a node based map as checking an entry can build the index of another list.
+	typedef std::map<ModeHandler::Id, ExtBanIndex> IndexMap;
+
 	ModeChannelBan& banmode;
 	Events::ModuleEventProvider evprov;
 	LetterMap byletter;
 	NameMap byname;
 
+	/** The indices of the list modes set on a channel. Built when first needed. */
+	mutable SimpleExtItem<IndexMap> indices;
+
+	/** A number which is changed every time an extban is added or removed. */
+	unsigned long serial = 0;
+
+	ExtBan::Base* Find(const std::string& xbname) const;
+	void BuildIndex(ExtBanIndex& index, const ListModeBase::ModeList& list, bool prefixed) const;
+
  public:
 	ExtBanManager(Module* Creator, ModeChannelBan& bm)
 		: ExtBan::Manager(Creator)
 		, banmode(bm)
 		, evprov(Creator, "event/extban")
+		, indices(Creator, "extban-index", ExtensionItem::EXT_CHANNEL)
 	{
 	}
 
@@ -249,6 +313,7 @@ class ExtBanManager : public ExtBan::Manager
 	const LetterMap& GetLetterMap() const override { return byletter; }
 	const NameMap& GetNameMap() const override { return byname; }
 	ModResult GetStatus(ExtBan::Acting* extban, User* user, Channel* channel) const override;
+	bool FindMatches(ListModeBase* mode, User* user, Channel* channel, ExtBan::Acting* acting, MatchList* matches, bool prefixed) const override;
 	ExtBan::Base* FindName(const std::string& name) const override;
 	ExtBan::Base* FindLetter(unsigned char letter) const override;
 	void BuildISupport(std::string& out);
@@ -20,10 +20,75 @@
 #include "inspircd.h"
 #include "core_channel.h"
 
+namespace
+{
+	/** Retrieves the part of a list mode entry which is matched against users. */
+	bool GetMask(const ListModeBase::ListItem& entry, bool prefixed, std::string& mask)
+	{
+		if (!prefixed)
+		{
+			mask = entry.mask;
+			return true;
+		}
+
+		std::string::size_type colon = entry.mask.find(':');
+		if (colon == std::string::npos)
+			return false;
+
+		mask.assign(entry.mask, colon + 1);
+		return true;
+	}
+}
+
 void ExtBanManager::AddExtBan(ExtBan::Base* extban)
 {
 	byletter.emplace(extban->GetLetter(), extban);
 	byname.emplace(extban->GetName(), extban);
+	serial++;
+}
+
+void ExtBanManager::BuildIndex(ExtBanIndex& index, const ListModeBase::ModeList& list, bool prefixed) const
+{
+	index.groups.clear();
+	for (size_t idx = 0; idx < list.size(); ++idx)
+	{
+		std::string mask;
+		if (!GetMask(list[idx], prefixed, mask))
+			continue;
+
+		bool inverted;
+		std::string xbname, xbvalue;
+		if (!ExtBan::Parse(mask, xbname, xbvalue, inverted))
+		{
+			index.groups[nullptr].others.push_back(idx);
+			continue;
+		}
+
+		ExtBan::Base* extban = Find(xbname);
+		ExtBan::Acting* acting = nullptr;
+		if (extban && extban->GetType() == ExtBan::Type::ACTING)
+		{
+			// Acting extbans match their value like a normal ban entry.
+			acting = static_cast<ExtBan::Acting*>(extban);
+			if (inverted || !ExtBan::Parse(xbvalue, xbname, xbvalue, inverted))
+			{
+				index.groups[acting].others.push_back(idx);
+				continue;
+			}
+			extban = Find(xbname);
+		}
+
+		if (extban && extban->GetType() == ExtBan::Type::MATCHING && !inverted && xbvalue.find_first_of("*?") == std::string::npos)
+		{
+			ExtBan::MatchingBase* matching = static_cast<ExtBan::MatchingBase*>(extban);
+			if (matching->HasMatchKey())
+			{
+				index.groups[acting].keyed[matching].emplace(xbvalue, idx);
+				continue;
+			}
+		}
+		index.groups[acting].others.push_back(idx);
+	}
 }
 
 void ExtBanManager::BuildISupport(std::string& out)
@@ -41,33 +106,94 @@ ModResult ExtBanManager::GetStatus(ExtBan::Acting* extban, User* user, Channel*
 	if (res != MOD_RES_PASSTHRU)
 		return res;
 
-	ListModeBase::ModeList* list = banmode.GetList(channel);
-	if (!list)
-		return MOD_RES_PASSTHRU;
+	return FindMatches(&banmode, user, channel, extban, nullptr, false) ? MOD_RES_DENY : MOD_RES_PASSTHRU;
+}
 
-	for (const ListModeBase::ListItem& ban : *list)
+bool ExtBanManager::FindMatches(ListModeBase* mode, User* user, Channel* channel, ExtBan::Acting* acting, MatchList* matches, bool prefixed) const
+{
+	ListModeBase::ModeList* list = mode->GetList(channel);
+	if (!list || list->empty())
+		return false;
+
+	IndexMap* indexmap = indices.get(channel);
+	if (!indexmap)
 	{
-		bool inverted;
-		std::string xbname, xbvalue;
-		if (!ExtBan::Parse(ban.mask, xbname, xbvalue, inverted))
+		indexmap = new IndexMap();
+		indices.set(channel, indexmap);
+	}
+
+	ExtBanIndex& index = (*indexmap)[mode->GetId()];
+	const unsigned long listserial = mode->GetSerial(channel);
+	if (index.listserial != listserial || index.extbanserial != serial)
+	{
+		BuildIndex(index, *list, prefixed);
+		index.listserial = listserial;
+		index.extbanserial = serial;
+	}
+
+	auto groupiter = index.groups.find(acting);
+	if (groupiter == index.groups.end())
+		return false;
+
+	const ExtBanIndex::Group& group = groupiter->second;
+
+	// Indices of the matching entries. This is only used when the caller wants
+	// every match; otherwise, we return as soon as one entry matches.
+	std::vector<size_t> found;
+	std::string key;
+	for (const auto& [matching, keys] : group.keyed)
+	{
+		key.clear();
+		if (!matching->GetMatchKey(user, key))
 			continue;
 
-		if (xbname.size() == 1)
+		auto range = keys.equal_range(key);
+		for (auto iter = range.first; iter != range.second; ++iter)
 		{
-			// It is an extban but not this extban.
-			if (xbname[0] != extban->GetLetter())
-				continue;
+			if (!matches)
+				return true;
+			found.push_back(iter->second);
 		}
-		else
+	}
+
+	std::string prefixedmask;
+	for (size_t idx : group.others)
+	{
+		// Only copy the mask if the prefix has to be removed from it.
+		const std::string* mask = &(*list)[idx].mask;
+		if (prefixed)
 		{
-			// It is an extban but not this extban.
-			if (!irc::equals(xbname, extban->GetName()))
-				continue;
+			GetMask((*list)[idx], prefixed, prefixedmask);
+			mask = &prefixedmask;
 		}
 
-		return extban->IsMatch(user, channel, xbvalue) != inverted ? MOD_RES_DENY : MOD_RES_PASSTHRU;
+		bool matched;
+		if (acting)
+		{
+			bool inverted;
+			std::string xbname, xbvalue;
+			ExtBan::Parse(*mask, xbname, xbvalue, inverted);
+			matched = acting->IsMatch(user, channel, xbvalue) != inverted;
+		}
+		else
+			matched = channel->CheckBan(user, *mask);
+
+		if (matched)
+		{
+			if (!matches)
+				return true;
+			found.push_back(idx);
+		}
 	}
-	return MOD_RES_PASSTHRU;
+
+	if (found.empty())
+		return false;
+
+	// Return the matches in the order they were added to the list.
+	std::sort(found.begin(), found.end());
+	for (size_t idx : found)
+		matches->push_back(&(*list)[idx]);
+	return true;
 }
 
 
@@ -75,6 +201,12 @@ void ExtBanManager::DelExtBan(ExtBan::Base* extban)
 {
 	byletter.erase(extban->GetLetter());
 	byname.erase(extban->GetName());
+	serial++;
+}
+
+ExtBan::Base* ExtBanManager::Find(const std::string& xbname) const
+{
+	return xbname.size() == 1 ? FindLetter(xbname[0]) : FindName(xbname);
 }
 
 ExtBan::Base* ExtBanManager::FindName(const std::string& xbname) const
@@ -29,7 +29,7 @@ class InviteExpireTimer : public Timer
 	bool Tick(time_t currtime) override;
 
  public:
-	InviteExpireTimer(Invite::Invite* invite, time_t timeout);
+	InviteExpireTimer(Module* mod, Invite::Invite* invite, time_t timeout);
 };
 
 static Invite::APIImpl* apiimpl;
@@ -122,7 +122,7 @@ void Invite::APIImpl::Create(LocalUser* user, Channel* chan, time_t timeout)
 		inv = new Invite(user, chan);
 		if (timeout)
 		{
-			inv->expiretimer = new InviteExpireTimer(inv, timeout - ServerInstance->Time());
+			inv->expiretimer = new InviteExpireTimer(creator, inv, timeout - ServerInstance->Time());
 			ServerInstance->Timers.AddTimer(inv->expiretimer);
 		}
 
@@ -194,8 +194,8 @@ void Invite::Invite::Serialize(bool human, bool show_chans, std::string& out)
 	out.push_back(' ');
 }
 
-InviteExpireTimer::InviteExpireTimer(Invite::Invite* invite, time_t timeout)
-	: Timer(timeout)
+InviteExpireTimer::InviteExpireTimer(Module* mod, Invite::Invite* invite, time_t timeout)
+	: Timer(timeout, false, mod)
 	, inv(invite)
 {
 }
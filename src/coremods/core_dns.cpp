@@ -21,6 +21,7 @@
 
 #include "inspircd.h"
 #include "modules/dns.h"
+#include "modules/stats.h"
 #include <iostream>
 #include <fstream>
 
@@ -339,18 +340,263 @@ class Packet : public Query
 	}
 };
 
-class MyManager : public Manager, public Timer, public EventHandler
+class MyManager;
+
+/** An upstream nameserver which queries can be sent to. */
+struct Nameserver
+{
+	/** The number of consecutive failures after which a nameserver is considered down. */
+	static const unsigned int MAX_FAILURES = 3;
+
+	/** The number of seconds a nameserver which is down is avoided for. */
+	static const time_t DOWN_TIME = 30;
+
+	/** The address of the nameserver. */
+	irc::sockets::sockaddrs addr;
+
+	/** The smoothed round trip time of the nameserver in milliseconds or 0 if not measured yet. */
+	unsigned long rtt = 0;
+
+	/** The number of consecutive queries which this nameserver failed to answer in time. */
+	unsigned int failures = 0;
+
+	/** The time until which this nameserver is considered down. */
+	time_t downuntil = 0;
+
+	/** Counters which are shown in /STATS T. */
+	unsigned long sent = 0;
+	unsigned long answered = 0;
+	unsigned long timedout = 0;
+	unsigned long truncated = 0;
+
+	Nameserver(const irc::sockets::sockaddrs& sa)
+		: addr(sa)
+	{
+	}
+
+	bool IsUp(time_t now = ServerInstance->Time()) const
+	{
+		return downuntil <= now;
+	}
+
+	void OnAnswer(unsigned long latency)
+	{
+		// Exponentially weighted moving average with a weight of 1/8 like the TCP RTT estimator.
+		// Never let it drop to 0 as that is used for nameservers which have not been measured yet.
+		rtt = std::max(rtt ? (rtt * 7 + latency + 4) / 8 : latency, 1UL);
+		answered++;
+		failures = 0;
+		downuntil = 0;
+	}
+
+	void OnFailure()
+	{
+		timedout++;
+		if (++failures >= MAX_FAILURES)
+			downuntil = ServerInstance->Time() + DOWN_TIME;
+	}
+};
+
+/** One of the UDP sockets that queries are sent from. */
+class UDPSocket : public EventHandler
+{
+	MyManager& manager;
+
+ public:
+	/** The address family of this socket. */
+	const int family;
+
+	UDPSocket(MyManager& mgr, Module* mod, int fam)
+		: EventHandler(mod)
+		, manager(mgr)
+		, family(fam)
+	{
+	}
+
+	~UDPSocket()
+	{
+		if (HasFd())
+		{
+			SocketEngine::Shutdown(this, 2);
+			SocketEngine::Close(this);
+		}
+	}
+
+	bool Open(const irc::sockets::sockaddrs& bindto)
+	{
+		SetFd(socket(bindto.family(), SOCK_DGRAM, 0));
+		if (!HasFd())
+			return false;
+
+		SocketEngine::NonBlocking(GetFd());
+		if (SocketEngine::Bind(GetFd(), bindto) < 0 || !SocketEngine::AddFd(this, FD_WANT_POLL_READ | FD_WANT_NO_WRITE))
+		{
+			SocketEngine::Close(GetFd());
+			SetFd(-1);
+			return false;
+		}
+		return true;
+	}
+
+	void OnEventHandlerError(int errcode) override
+	{
+		ServerInstance->Logs.Log(MODNAME, LOG_DEBUG, "UDP socket got an error event");
+	}
+
+	void OnEventHandlerRead() override;
+};
+
+/** A query which is retried over TCP because the UDP answer was truncated. */
+class TCPQuery : public BufferedSocket
+{
+	MyManager* manager;
+	const irc::sockets::sockaddrs server;
+	std::string query;
+	bool waitingcull = false;
+
+ public:
+	/** The id of the request this query is for. */
+	const RequestId id;
+
+	TCPQuery(MyManager* mgr, Module* mod, const irc::sockets::sockaddrs& sa, const std::string& packet, RequestId reqid, unsigned int timeout)
+		: BufferedSocket(mod)
+		, manager(mgr)
+		, server(sa)
+		, id(reqid)
+	{
+		// Messages sent over TCP are prefixed with a two byte length field.
+		query.push_back(packet.length() >> 8);
+		query.push_back(packet.length() & 0xFF);
+		query.append(packet);
+
+		irc::sockets::sockaddrs bindto;
+		memset(&bindto, 0, sizeof(bindto));
+		DoConnect(server, bindto, timeout);
+	}
+
+	/** Stops this query from notifying the manager and closes it. */
+	void Detach()
+	{
+		manager = nullptr;
+		Close();
+	}
+
+	void Close() override
+	{
+		if (waitingcull)
+			return;
+
+		waitingcull = true;
+		BufferedSocket::Close();
+		ServerInstance->GlobalCulls.AddItem(this);
+	}
+
+	void OnConnected() override
+	{
+		WriteData(query);
+	}
+
+	void OnDataReady() override;
+	void OnError(BufferedSocketError err) override;
+};
+
+class MyManager : public Manager, public Timer
 {
 	typedef std::unordered_map<Question, Query, Question::hash> cache_map;
 	cache_map cache;
 
-	irc::sockets::sockaddrs myserver;
+	/** An attempt to get an answer for a request from a nameserver. */
+	struct Attempt
+	{
+		/** The index of the nameserver in servers. */
+		size_t server;
+
+		/** The socket the query was sent on. */
+		EventHandler* via;
+
+		/** The time at which the query was sent in milliseconds. */
+		uint64_t sent;
+
+		/** Whether an answer was received or the nameserver was penalised for not answering. */
+		bool done = false;
+
+		Attempt(size_t s, EventHandler* eh, uint64_t ms)
+			: server(s)
+			, via(eh)
+			, sent(ms)
+		{
+		}
+	};
+
+	/** The state of a request which has been sent to one or more nameservers. */
+	struct Inflight
+	{
+		/** The packed query. */
+		std::string packet;
+
+		/** The nameservers the query has been sent to. */
+		std::vector<Attempt> attempts;
+
+		/** The time at which the query should be sent to another nameserver. */
+		time_t nexthedge = 0;
+
+		/** If the answer was truncated then the TCP connection the query was retried on. */
+		TCPQuery* tcp = nullptr;
+
+		Attempt* FindAttempt(const EventHandler* via, const irc::sockets::sockaddrs& from, const std::vector<Nameserver>& servers)
+		{
+			for (auto& attempt : attempts)
+			{
+				if (attempt.via == via && attempt.server < servers.size() && servers[attempt.server].addr == from)
+					return &attempt;
+			}
+			return nullptr;
+		}
+	};
+
+	/** The nameservers that queries are sent to. */
+	std::vector<Nameserver> servers;
+
+	/** The UDP sockets that queries are sent from. */
+	std::vector<std::unique_ptr<UDPSocket>> sockets;
+
+	/** The requests which are waiting for an answer, keyed by request id. */
+	std::unordered_map<RequestId, Inflight> inflight;
+
+	/** The number of seconds to wait for an answer before also asking the next nameserver, or 0 to ask every nameserver at once. */
+	unsigned long hedge = 1;
+
 	bool unloading = false;
 
+	/** Periodically sends requests which have not been answered to the next nameserver. */
+	class HedgeTimer : public Timer
+	{
+		MyManager& manager;
+
+	 public:
+		HedgeTimer(MyManager& mgr)
+			: Timer(1, true, mgr.creator)
+			, manager(mgr)
+		{
+			ServerInstance->Timers.AddTimer(this);
+		}
+
+		bool Tick(time_t now) override
+		{
+			manager.Hedge(now);
+			return true;
+		}
+	} hedgetimer;
+
 	/** Maximum number of entries in cache
 	 */
 	static const unsigned int MAX_CACHE_SIZE = 1000;
 
+	static uint64_t NowMillis()
+	{
+		return uint64_t(ServerInstance->Time()) * 1000 + ServerInstance->Time_ns() / 1000000;
+	}
+
 	static bool IsExpired(const Query& record, time_t now = ServerInstance->Time())
 	{
 		const ResourceRecord& req = record.answers[0];
@@ -406,12 +652,101 @@ class MyManager : public Manager, public Timer, public EventHandler
 		this->cache[r.question] = r;
 	}
 
+	/** Picks the nameserver to send a request to next. Nameservers which are up are
+	 * preferred over ones which are down and faster nameservers over slower ones.
+	 * @return The index of the nameserver or SIZE_MAX if every nameserver has been tried.
+	 */
+	size_t PickServer(const Inflight& state) const
+	{
+		const time_t now = ServerInstance->Time();
+		size_t best = SIZE_MAX;
+		for (size_t idx = 0; idx < servers.size(); ++idx)
+		{
+			bool tried = false;
+			for (const auto& attempt : state.attempts)
+				tried |= (attempt.server == idx);
+			if (tried)
+				continue;
+
+			if (best == SIZE_MAX)
+			{
+				best = idx;
+				continue;
+			}
+
+			const Nameserver& current = servers[best];
+			const Nameserver& candidate = servers[idx];
+			if (current.IsUp(now) != candidate.IsUp(now))
+			{
+				if (candidate.IsUp(now))
+					best = idx;
+			}
+			else if (!candidate.IsUp(now))
+			{
+				if (candidate.downuntil < current.downuntil)
+					best = idx;
+			}
+			else if (candidate.rtt < current.rtt)
+				best = idx;
+		}
+		return best;
+	}
+
+	/** Sends a request to the next nameserver which has not been tried yet.
+	 * @return True if the request was sent; otherwise, false.
+	 */
+	bool SendNext(Inflight& state)
+	{
+		for (size_t idx; (idx = PickServer(state)) != SIZE_MAX; )
+		{
+			Nameserver& server = servers[idx];
+
+			// Spread queries over the sockets in the pool so that the source port
+			// of a query is as hard to guess as its id.
+			std::vector<UDPSocket*> candidates;
+			for (const auto& sock : sockets)
+			{
+				if (sock->HasFd() && sock->family == server.addr.family())
+					candidates.push_back(sock.get());
+			}
+
+			UDPSocket* sock = candidates.empty() ? nullptr : candidates[ServerInstance->GenRandomInt(candidates.size())];
+			state.attempts.emplace_back(idx, sock, NowMillis());
+			if (sock && SocketEngine::SendTo(sock, state.packet.data(), state.packet.length(), 0, server.addr) == static_cast<int>(state.packet.length()))
+			{
+				server.sent++;
+				return true;
+			}
+
+			ServerInstance->Logs.Log(MODNAME, LOG_DEBUG, "Unable to send query to %s", server.addr.str().c_str());
+			state.attempts.back().done = true;
+			server.OnFailure();
+		}
+		return false;
+	}
+
+	/** Retries a request over TCP because the answer from a nameserver was truncated. */
+	void SendTCP(RequestId id, Inflight& state, size_t idx)
+	{
+		if (state.tcp)
+			return;
+
+		Nameserver& server = servers[idx];
+		server.truncated++;
+		ServerInstance->Logs.Log(MODNAME, LOG_DEBUG, "Answer from %s was truncated, retrying over TCP", server.addr.str().c_str());
+
+		state.tcp = new TCPQuery(this, creator, server.addr, state.packet, id, ServerInstance->Config->ConfValue("dns")->getDuration("timeout", 5, 1));
+		state.attempts.emplace_back(idx, state.tcp, NowMillis());
+		server.sent++;
+	}
+
  public:
 	DNS::Request* requests[MAX_REQUEST_ID+1];
 
 	MyManager(Module* c)
 		: Manager(c)
-		, Timer(5*60, true)
+		, Timer(5*60, true, c)
+		, hedgetimer(*this)
 	{
 		for (unsigned int i = 0; i <= MAX_REQUEST_ID; ++i)
 			requests[i] = NULL;
@@ -437,12 +772,17 @@ class MyManager : public Manager, public Timer, public EventHandler
 		}
 	}
 
+	const std::vector<Nameserver>& GetServers() const
+	{
+		return servers;
+	}
+
 	void Process(DNS::Request* req) override
 	{
 		if ((unloading) || (req->creator->dying))
 			throw Exception("Module is being unloaded");
 
-		ServerInstance->Logs.Log(MODNAME, LOG_DEBUG, "Processing request to lookup " + req->question.name + " of type " + ConvToStr(req->question.type) + " to " + this->myserver.addr());
+		ServerInstance->Logs.Log(MODNAME, LOG_DEBUG, "Processing request to lookup " + req->question.name + " of type " + ConvToStr(req->question.type));
 
 		/* Create an id */
 		unsigned int tries = 0;
@@ -497,17 +837,42 @@ class MyManager : public Manager, public Timer, public EventHandler
 		// Update name in the original request so question checking works for PTR queries
 		req->question.name = p.question.name;
 
-		if (SocketEngine::SendTo(this, buffer, len, 0, this->myserver) != len)
+		Inflight& state = inflight[req->id];
+		state.packet.assign(reinterpret_cast<const char*>(buffer), len);
+		state.nexthedge = ServerInstance->Time() + hedge;
+		if (!SendNext(state))
 			throw Exception("DNS: Unable to send query");
 
+		// If hedging is disabled then race every nameserver against each other.
+		if (!hedge)
+			while (SendNext(state)) { }
+
 		// Add timer for timeout
 		ServerInstance->Timers.AddTimer(req);
 	}
 
 	void RemoveRequest(DNS::Request* req) override
 	{
-		if (requests[req->id] == req)
-			requests[req->id] = NULL;
+		if (requests[req->id] != req)
+			return;
+
+		requests[req->id] = NULL;
+
+		auto it = inflight.find(req->id);
+		if (it == inflight.end())
+			return;
+
+		// The request was not answered by any of the nameservers it was sent to.
+		Inflight& state = it->second;
+		for (auto& attempt : state.attempts)
+		{
+			if (!attempt.done && attempt.server < servers.size())
+				servers[attempt.server].OnFailure();
+		}
+
+		if (state.tcp)
+			state.tcp->Detach();
+		inflight.erase(it);
 	}
 
 	std::string GetErrorStr(Error e) override
@@ -557,31 +922,17 @@ class MyManager : public Manager, public Timer, public EventHandler
 		}
 	}
 
-	void OnEventHandlerError(int errcode) override
-	{
-		ServerInstance->Logs.Log(MODNAME, LOG_DEBUG, "UDP socket got an error event");
-	}
-
-	void OnEventHandlerRead() override
+	/** Handles an answer received from a nameserver.
+	 * @param via The socket that the answer was received on.
+	 * @param from The address that the answer was received from.
+	 * @param buffer The raw answer.
+	 * @param length The length of the raw answer.
+	 */
+	void HandleAnswer(EventHandler* via, const irc::sockets::sockaddrs& from, const unsigned char* buffer, unsigned short length)
 	{
-		unsigned char buffer[524];
-		irc::sockets::sockaddrs from;
-		socklen_t x = sizeof(from);
-
-		int length = SocketEngine::RecvFrom(this, buffer, sizeof(buffer), 0, &from.sa, &x);
-
 		if (length < Packet::HEADER_LENGTH)
 			return;
 
-		if (myserver != from)
-		{
-			std::string server1 = from.str();
-			std::string server2 = myserver.str();
-			ServerInstance->Logs.Log(MODNAME, LOG_DEBUG, "Got a result from the wrong server! Bad NAT or DNS forging attempt? '%s' != '%s'",
-				server1.c_str(), server2.c_str());
-			return;
-		}
-
 		Packet recv_packet;
 		bool valid = false;
 
@@ -597,12 +948,28 @@ class MyManager : public Manager, public Timer, public EventHandler
 
 		// recv_packet.id must be filled in here
 		DNS::Request* request = this->requests[recv_packet.id];
-		if (request == NULL)
+		auto it = inflight.find(recv_packet.id);
+		if (request == NULL || it == inflight.end())
 		{
 			ServerInstance->Logs.Log(MODNAME, LOG_DEBUG, "Received an answer for something we didn't request");
 			return;
 		}
 
+		// A TCP query detaches itself before handing its answer over so it must
+		// be forgotten now; it is freed on the next cull whatever happens here.
+		Inflight& state = it->second;
+		const bool viatcp = via == state.tcp;
+		if (viatcp)
+			state.tcp = nullptr;
+
+		Attempt* attempt = state.FindAttempt(via, from, servers);
+		if (!attempt)
+		{
+			ServerInstance->Logs.Log(MODNAME, LOG_DEBUG, "Got a result from the wrong server! Bad NAT or DNS forging attempt? '%s'",
+				from.str().c_str());
+			return;
+		}
+
 		if (request->question != recv_packet.question)
 		{
 			// This can happen under high latency, drop it silently, do not fail the request
@@ -610,6 +977,39 @@ class MyManager : public Manager, public Timer, public EventHandler
 			return;
 		}
 
+		Nameserver& server = servers[attempt->server];
+		if ((recv_packet.flags & QUERYFLAGS_TC) && !viatcp)
+		{
+			attempt->done = true;
+			SendTCP(recv_packet.id, state, attempt->server);
+			return;
+		}
+
+		const unsigned int rcode = recv_packet.flags & QUERYFLAGS_RCODE;
+		if (!valid || rcode == 2 || rcode == 4 || rcode == 5)
+		{
+			// The nameserver is broken or refuses to answer; give the other
+			// nameservers a chance to answer before failing the request.
+			if (!attempt->done)
+				server.OnFailure();
+			attempt->done = true;
+
+			bool outstanding = false;
+			for (const auto& other : state.attempts)
+				outstanding |= !other.done;
+			if (outstanding || SendNext(state))
+				return;
+		}
+		else
+		{
+			attempt->done = true;
+			server.OnAnswer(NowMillis() - attempt->sent);
+		}
+
+		if (state.tcp)
+			state.tcp->Detach();
+		inflight.erase(it);
+
 		if (!valid)
 		{
 			ServerInstance->stats.DnsBad++;
@@ -678,6 +1078,55 @@ class MyManager : public Manager, public Timer, public EventHandler
 		delete request;
 	}
 
+	/** Handles a TCP query failing before an answer was received. */
+	void HandleTCPError(TCPQuery* tcp)
+	{
+		auto it = inflight.find(tcp->id);
+		if (it == inflight.end() || it->second.tcp != tcp)
+			return;
+
+		Inflight& state = it->second;
+		state.tcp = nullptr;
+		for (auto& attempt : state.attempts)
+		{
+			if (attempt.via == tcp && !attempt.done)
+			{
+				attempt.done = true;
+				servers[attempt.server].OnFailure();
+			}
+		}
+
+		// Try the remaining nameservers; if there are none the request will time out.
+		SendNext(state);
+	}
+
+	/** Sends requests which have not been answered within the hedging delay to the next nameserver. */
+	void Hedge(time_t now)
+	{
+		if (!hedge)
+			return;
+
+		const uint64_t deadline = NowMillis() - hedge * 1000;
+		for (auto& [id, state] : inflight)
+		{
+			if (state.tcp || state.nexthedge > now)
+				continue;
+
+			for (auto& attempt : state.attempts)
+			{
+				if (!attempt.done && attempt.sent <= deadline)
+				{
+					attempt.done = true;
+					servers[attempt.server].OnFailure();
+				}
+			}
+
+			state.nexthedge = now + hedge;
+			if (SendNext(state))
+				ServerInstance->Logs.Log(MODNAME, LOG_DEBUG, "Request %u was not answered in time, sent it to another nameserver", id);
+		}
+	}
+
 	bool Tick(time_t now) override
 	{
 		unsigned long expired = 0;
@@ -699,70 +1148,145 @@ class MyManager : public Manager, public Timer, public EventHandler
 		return true;
 	}
 
-	void Rehash(const std::string& dnsserver, std::string sourceaddr, unsigned int sourceport)
+	void SetHedge(unsigned long newhedge)
 	{
-		if (this->HasFd())
+		hedge = newhedge;
+	}
+
+	void Rehash(const std::vector<std::string>& dnsservers, const std::string& sourceaddr, unsigned int sourceport, unsigned long poolsize)
+	{
+		if (!sockets.empty())
 		{
-			SocketEngine::Shutdown(this, 2);
-			SocketEngine::Close(this);
+			sockets.clear();
 
 			// Remove all entries from the cache.
 			cache.clear();
 		}
 
-		irc::sockets::aptosa(dnsserver, DNS::PORT, myserver);
+		servers.clear();
+		for (const auto& dnsserver : dnsservers)
+		{
+			irc::sockets::sockaddrs sa;
+			if (irc::sockets::aptosa(dnsserver, DNS::PORT, sa))
+				servers.emplace_back(sa);
+			else
+				ServerInstance->Logs.Log(MODNAME, LOG_SPARSE, "Nameserver '%s' is not a valid IP address, ignoring", dnsserver.c_str());
+		}
+
+		// Requests which are in flight will be resent to the new nameservers below.
+		for (auto& entry : inflight)
+		{
+			Inflight& state = entry.second;
+			state.attempts.clear();
+			if (state.tcp)
+			{
+				state.tcp->Detach();
+				state.tcp = nullptr;
+			}
+		}
 
-		/* Initialize mastersocket */
-		int s = socket(myserver.family(), SOCK_DGRAM, 0);
-		this->SetFd(s);
+		// Only one socket can be bound to a fixed source port.
+		if (sourceport)
+			poolsize = 1;
 
-		/* Have we got a socket? */
-		if (this->GetFd() != -1)
+		for (int family : { AF_INET, AF_INET6 })
 		{
-			SocketEngine::SetReuse(s);
-			SocketEngine::NonBlocking(s);
+			bool needed = false;
+			for (const auto& server : servers)
+				needed |= (server.addr.family() == family);
+			if (!needed)
+				continue;
 
 			irc::sockets::sockaddrs bindto;
-			if (sourceaddr.empty())
+			if (!irc::sockets::aptosa(sourceaddr.empty() ? (family == AF_INET ? "0.0.0.0" : "::") : sourceaddr, sourceport, bindto) || bindto.family() != family)
 			{
-				// set a sourceaddr for irc::sockets::aptosa() based on the servers af type
-				if (myserver.family() == AF_INET)
-					sourceaddr = "0.0.0.0";
-				else if (myserver.family() == AF_INET6)
-					sourceaddr = "::";
+				ServerInstance->Logs.Log(MODNAME, LOG_SPARSE, "Nameserver address family differs from source address family - hostnames might not resolve");
+				continue;
 			}
-			irc::sockets::aptosa(sourceaddr, sourceport, bindto);
 
-			if (SocketEngine::Bind(this->GetFd(), bindto) < 0)
+			for (unsigned long i = 0; i < poolsize; ++i)
 			{
-				/* Failed to bind */
-				ServerInstance->Logs.Log(MODNAME, LOG_SPARSE, "Error binding dns socket - hostnames will NOT resolve");
-				SocketEngine::Close(this->GetFd());
-				this->SetFd(-1);
+				auto sock = std::make_unique<UDPSocket>(*this, creator, family);
+				if (!sock->Open(bindto))
+				{
+					ServerInstance->Logs.Log(MODNAME, LOG_SPARSE, "Error creating DNS socket - hostnames might not resolve: %s", SocketEngine::LastError().c_str());
+					break;
+				}
+				sockets.push_back(std::move(sock));
 			}
-			else if (!SocketEngine::AddFd(this, FD_WANT_POLL_READ | FD_WANT_NO_WRITE))
+		}
+
+		if (sockets.empty())
+			ServerInstance->Logs.Log(MODNAME, LOG_SPARSE, "Unable to create any DNS sockets - hostnames will NOT resolve");
+
+		// The old sockets are gone so anything which was in flight has to be sent again.
+		for (auto& [id, state] : inflight)
+		{
+			state.nexthedge = ServerInstance->Time() + hedge;
+			if (!SendNext(state))
 			{
-				ServerInstance->Logs.Log(MODNAME, LOG_SPARSE, "Internal error starting DNS - hostnames will NOT resolve.");
-				SocketEngine::Close(this->GetFd());
-				this->SetFd(-1);
+				// The request will time out.
+				ServerInstance->Logs.Log(MODNAME, LOG_DEBUG, "Unable to resend request %u after rehash", id);
+				continue;
 			}
 
-			if (bindto.family() != myserver.family())
-				ServerInstance->Logs.Log(MODNAME, LOG_SPARSE, "Nameserver address family differs from source address family - hostnames might not resolve");
-		}
-		else
-		{
-			ServerInstance->Logs.Log(MODNAME, LOG_SPARSE, "Error creating DNS socket - hostnames will NOT resolve");
+			// If hedging is disabled then race every nameserver against each other.
+			if (!hedge)
+				while (SendNext(state)) { }
 		}
 	}
 };
 
-class ModuleDNS : public Module
+void UDPSocket::OnEventHandlerRead()
+{
+	unsigned char buffer[524];
+	irc::sockets::sockaddrs from;
+	socklen_t x = sizeof(from);
+
+	int length = SocketEngine::RecvFrom(this, buffer, sizeof(buffer), 0, &from.sa, &x);
+	if (length > 0)
+		manager.HandleAnswer(this, from, buffer, length);
+}
+
+void TCPQuery::OnDataReady()
+{
+	if (recvq.length() < 2)
+		return;
+
+	const size_t length = static_cast<unsigned char>(recvq[0]) << 8 | static_cast<unsigned char>(recvq[1]);
+	if (recvq.length() < length + 2)
+		return;
+
+	const std::string answer(recvq, 2, length);
+	MyManager* mgr = manager;
+	Detach();
+	if (mgr)
+	{
+		mgr->HandleAnswer(this, server, reinterpret_cast<const unsigned char*>(answer.data()), answer.length());
+
+		// If the answer was not for the request this query was sent for then
+		// that request has to be treated as if the query failed.
+		mgr->HandleTCPError(this);
+	}
+}
+
+void TCPQuery::OnError(BufferedSocketError err)
+{
+	ServerInstance->Logs.Log(MODNAME, LOG_DEBUG, "TCP query to %s failed: %s", server.str().c_str(), GetError().c_str());
+
+	MyManager* mgr = manager;
+	Detach();
+	if (mgr)
+		mgr->HandleTCPError(this);
+}
+
+class ModuleDNS : public Module, public Stats::EventListener
 {
 	MyManager manager;
-	std::string DNSServer;
+	std::vector<std::string> DNSServers;
 	std::string SourceIP;
 	unsigned int SourcePort = 0;
+	unsigned long PoolSize = 0;
 
 	void FindDNSServer()
 	{
@@ -785,14 +1309,20 @@ class ModuleDNS : public Module
 			if (pFixedInfo)
 			{
 				if (GetNetworkParams(pFixedInfo, &dwBufferSize) == NO_ERROR)
-					DNSServer = pFixedInfo->DnsServerList.IpAddress.String;
+				{
+					for (PIP_ADDR_STRING server = &pFixedInfo->DnsServerList; server; server = server->Next)
+					{
+						if (*server->IpAddress.String)
+							DNSServers.push_back(server->IpAddress.String);
+					}
+				}
 
 				HeapFree(GetProcessHeap(), 0, pFixedInfo);
 			}
 
-			if (!DNSServer.empty())
+			if (!DNSServers.empty())
 			{
-				ServerInstance->Logs.Log(MODNAME, LOG_DEFAULT, "<dns:server> set to '%s' as first active resolver in the system settings.", DNSServer.c_str());
+				ServerInstance->Logs.Log(MODNAME, LOG_DEFAULT, "<dns:server> set to '%s' from the system settings.", stdalgo::string::join(DNSServers).c_str());
 				return;
 			}
 		}
@@ -804,47 +1334,58 @@ class ModuleDNS : public Module
 
 		std::ifstream resolv("/etc/resolv.conf");
 
-		while (resolv >> DNSServer)
+		std::string token;
+		while (resolv >> token)
 		{
-			if (DNSServer == "nameserver")
+			if (token == "nameserver")
 			{
-				resolv >> DNSServer;
-				if (DNSServer.find_first_not_of("0123456789.") == std::string::npos || DNSServer.find_first_not_of("0123456789ABCDEFabcdef:") == std::string::npos)
-				{
-					ServerInstance->Logs.Log(MODNAME, LOG_DEFAULT, "<dns:server> set to '%s' as first resolver in /etc/resolv.conf.",DNSServer.c_str());
-					return;
-				}
+				resolv >> token;
+				if (token.find_first_not_of("0123456789.") == std::string::npos || token.find_first_not_of("0123456789ABCDEFabcdef:") == std::string::npos)
+					DNSServers.push_back(token);
 			}
 		}
 
+		if (!DNSServers.empty())
+		{
+			ServerInstance->Logs.Log(MODNAME, LOG_DEFAULT, "<dns:server> set to '%s' from /etc/resolv.conf.", stdalgo::string::join(DNSServers).c_str());
+			return;
+		}
+
 		ServerInstance->Logs.Log(MODNAME, LOG_DEFAULT, "/etc/resolv.conf contains no viable nameserver entries! Defaulting to nameserver '127.0.0.1'!");
 #endif
-		DNSServer = "127.0.0.1";
+		DNSServers.push_back("127.0.0.1");
 	}
 
  public:
 	ModuleDNS()
 		: Module(VF_CORE | VF_VENDOR, "Provides support for DNS lookups")
+		, Stats::EventListener(this)
 		, manager(this)
 	{
 	}
 
 	void ReadConfig(ConfigStatus& status) override
 	{
-		std::string oldserver = DNSServer;
+		const std::vector<std::string> oldservers = DNSServers;
 		const std::string oldip = SourceIP;
 		const unsigned int oldport = SourcePort;
+		const unsigned long oldpoolsize = PoolSize;
 
 		auto tag = ServerInstance->Config->ConfValue("dns");
-		DNSServer = tag->getString("server");
+		DNSServers.clear();
+		irc::spacesepstream serverstream(tag->getString("server"));
+		for (std::string server; serverstream.GetToken(server); )
+			DNSServers.push_back(server);
 		SourceIP = tag->getString("sourceip");
 		SourcePort = tag->getUInt("sourceport", 0, 0, UINT16_MAX);
+		PoolSize = tag->getUInt("sockets", 4, 1, 64);
+		manager.SetHedge(tag->getDuration("hedge", 1, 0, 60));
 
-		if (DNSServer.empty())
+		if (DNSServers.empty())
 			FindDNSServer();
 
-		if (oldserver != DNSServer || oldip != SourceIP || oldport != SourcePort)
-			this->manager.Rehash(DNSServer, SourceIP, SourcePort);
+		if (oldservers != DNSServers || oldip != SourceIP || oldport != SourcePort || oldpoolsize != PoolSize)
+			this->manager.Rehash(DNSServers, SourceIP, SourcePort, PoolSize);
 	}
 
 	void OnUnloadModule(Module* mod) override
@@ -865,7 +1406,20 @@ class ModuleDNS : public Module
 			}
 		}
 	}
+
+	ModResult OnStats(Stats::Context& stats) override
+	{
+		if (stats.GetSymbol() != 'T')
+			return MOD_RES_PASSTHRU;
+
+		for (const auto& server : manager.GetServers())
+		{
+			stats.AddRow(249, InspIRCd::Format("nameserver %s %s rtt %lums sent %lu answered %lu timed out %lu truncated %lu",
+				server.addr.addr().c_str(), server.IsUp() ? "up" : "down", server.rtt, server.sent, server.answered,
+				server.timedout, server.truncated));
+		}
+		return MOD_RES_PASSTHRU;
+	}
 };
 
 MODULE_INIT(ModuleDNS)
-
@@ -22,42 +22,189 @@
 
 #include "inspircd.h"
 #include "modules/dns.h"
+#include "modules/stats.h"
 
 namespace
 {
 	IntExtItem* dl;
+
+	// The number of seconds to remember that the hostname of an IP address could not be verified.
+	const unsigned int NEGATIVE_TTL = 60;
+
+	// The maximum number of seconds to remember the verified hostname of an IP address.
+	const unsigned int MAX_POSITIVE_TTL = 3600;
+
+	uint64_t NowMillis()
+	{
+		return uint64_t(ServerInstance->Time()) * 1000 + ServerInstance->Time_ns() / 1000000;
+	}
 }
 
-/** Derived from Resolver, and performs user forward/reverse lookups.
+/** The result of verifying the hostname of an IP address. */
+struct LookupResult
+{
+	/** The verified hostname or an empty string if verification failed. */
+	std::string hostname;
+
+	/** If verification failed then the message to send to users. */
+	std::string error;
+
+	/** The time at which this result should no longer be used. */
+	time_t expiry;
+};
+
+/** A hostname verification which is in progress for an IP address. */
+struct PendingLookup
+{
+	/** The UUIDs of the users who are waiting for the verification to finish. */
+	std::vector<std::string> users;
+
+	/** The time the verification started at in milliseconds. */
+	uint64_t started;
+};
+
+/** Coalesces the forward-confirmed reverse DNS lookups of users connecting from the same IP address
+ * and caches the results so that they can be shared with later users.
+ */
+class LookupPipeline
+{
+ public:
+	/** The verifications which are in progress keyed by IP address. */
+	std::unordered_map<std::string, PendingLookup> pending;
+
+	/** The results of verifications which have finished keyed by IP address. */
+	std::unordered_map<std::string, LookupResult> results;
+
+	/** The number of verifications which have finished. */
+	unsigned long completed = 0;
+
+	/** The number of users who were given a result from the cache. */
+	unsigned long cachehits = 0;
+
+	/** The number of users who joined a verification which was already in progress. */
+	unsigned long coalesced = 0;
+
+	/** The total and maximum time that finished verifications took in milliseconds. */
+	uint64_t totallatency = 0;
+	uint64_t maxlatency = 0;
+
+	/** Applies the result of a verification to a user. */
+	static void Apply(LocalUser* user, const LookupResult& result, bool cached)
+	{
+		if (result.hostname.empty())
+		{
+			user->WriteNotice("*** " + result.error + "; using your IP address (" + user->GetIPString() + ") instead.");
+
+			bool display_is_real = user->GetDisplayedHost() == user->GetRealHost();
+			user->ChangeRealHost(user->GetIPString(), display_is_real);
+		}
+		else
+		{
+			user->WriteNotice("*** Found your hostname (" + result.hostname + (cached ? ") -- cached" : ")"));
+			bool display_is_real = user->GetDisplayedHost() == user->GetRealHost();
+			user->ChangeRealHost(result.hostname, display_is_real);
+		}
+		dl->unset(user);
+	}
+
+	/** Finishes the verification for an IP address and releases all of the users waiting for it.
+	 * @param ip The IP address that was verified.
+	 * @param hostname The verified hostname or an empty string if verification failed.
+	 * @param error If verification failed then the message to send to users.
+	 * @param ttl The number of seconds to cache the result for or 0 to not cache it.
+	 * @param cached Whether the DNS answers came from the cache of the DNS manager.
+	 */
+	void Finish(const std::string& ip, const std::string& hostname, const std::string& error, unsigned int ttl, bool cached)
+	{
+		LookupResult result;
+		result.hostname = hostname;
+		result.error = error;
+		result.expiry = ServerInstance->Time() + ttl;
+		if (ttl)
+			results[ip] = result;
+
+		auto iter = pending.find(ip);
+		if (iter == pending.end())
+			return;
+
+		const uint64_t latency = NowMillis() - iter->second.started;
+		totallatency += latency;
+		maxlatency = std::max(maxlatency, latency);
+		completed++;
+
+		for (const auto& uuid : iter->second.users)
+		{
+			LocalUser* user = IS_LOCAL(ServerInstance->Users.FindUUID(uuid));
+			if (!user || user->quitting)
+			{
+				ServerInstance->Logs.Log(MODNAME, LOG_DEBUG, "Resolution finished for user '%s' who is gone", uuid.c_str());
+				continue;
+			}
+
+			// The IP address of the user may have been changed (e.g. by a WebIRC
+			// gateway) whilst the lookup was in progress.
+			if (user->GetIPString() == ip)
+				Apply(user, result, cached);
+			else
+				dl->unset(user);
+		}
+		pending.erase(iter);
+	}
+
+	/** Removes the results which have expired. */
+	void Prune()
+	{
+		for (auto iter = results.begin(); iter != results.end(); )
+		{
+			if (iter->second.expiry <= ServerInstance->Time())
+				iter = results.erase(iter);
+			else
+				++iter;
+		}
+	}
+};
+
+/** Performs the reverse and then forward lookup of an IP address.
  */
 class UserResolver : public DNS::Request
 {
  private:
-	/** UUID we are looking up */
-	const std::string uuid;
+	/** The pipeline that this lookup is part of. */
+	LookupPipeline& pipeline;
 
-	/** Handles errors which happen during DNS resolution. */
-	static void HandleError(LocalUser* user, const std::string& message)
-	{
-		user->WriteNotice("*** " + message + "; using your IP address (" + user->GetIPString() + ") instead.");
+	/** The IP address which is being verified. */
+	const irc::sockets::sockaddrs sa;
 
-		bool display_is_real = user->GetDisplayedHost() == user->GetRealHost();
-		user->ChangeRealHost(user->GetIPString(), display_is_real);
+	/** The IP address which is being verified in string form. */
+	const std::string ip;
 
-		dl->unset(user);
+	/** If this is a forward lookup then the TTL of the PTR record. */
+	const unsigned int ptrttl;
+
+	/** Handles errors which happen during DNS resolution. */
+	void HandleError(const std::string& message, bool definitive)
+	{
+		// Timeouts and server failures are often transient so only remember
+		// failures where the DNS server gave us a definitive answer.
+		pipeline.Finish(ip, "", message, definitive ? NEGATIVE_TTL : 0, false);
 	}
 
  public:
 	/** Create a resolver.
 	 * @param mgr DNS Manager
 	 * @param me this module
-	 * @param user The user to begin lookup on
+	 * @param lp The pipeline that this lookup is part of
+	 * @param addr The IP address which is being verified
 	 * @param to_resolve The IP or host to resolve
 	 * @param qt The query type
+	 * @param ttl If this is a forward lookup then the TTL of the PTR record
 	 */
-	UserResolver(DNS::Manager* mgr, Module* me, LocalUser* user, const std::string& to_resolve, DNS::QueryType qt)
+	UserResolver(DNS::Manager* mgr, Module* me, LookupPipeline& lp, const irc::sockets::sockaddrs& addr, const std::string& to_resolve, DNS::QueryType qt, unsigned int ttl = 0)
 		: DNS::Request(mgr, me, to_resolve, qt)
-		, uuid(user->uuid)
+		, pipeline(lp)
+		, sa(addr)
+		, ip(addr.addr())
+		, ptrttl(ttl)
 	{
 	}
 
@@ -67,37 +214,30 @@ class UserResolver : public DNS::Request
 	 */
 	void OnLookupComplete(const DNS::Query* r) override
 	{
-		LocalUser* bound_user = IS_LOCAL(ServerInstance->Users.FindUUID(uuid));
-		if (!bound_user)
-		{
-			ServerInstance->Logs.Log(MODNAME, LOG_DEBUG, "Resolution finished for user '%s' who is gone", uuid.c_str());
-			return;
-		}
-
 		const DNS::ResourceRecord* ans_record = r->FindAnswerOfType(this->question.type);
 		if (ans_record == NULL)
 		{
-			HandleError(bound_user, "Could not resolve your hostname: No " + this->manager->GetTypeStr(this->question.type) + " records found");
+			HandleError("Could not resolve your hostname: No " + this->manager->GetTypeStr(this->question.type) + " records found", true);
 			return;
 		}
 
 		ServerInstance->Logs.Log(MODNAME, LOG_DEBUG, "DNS %s result for %s: '%s' -> '%s'%s",
-			this->manager->GetTypeStr(question.type).c_str(), uuid.c_str(),
+			this->manager->GetTypeStr(question.type).c_str(), ip.c_str(),
 			ans_record->name.c_str(), ans_record->rdata.c_str(),
 			r->cached ? " (cached)" : "");
 
 		if (this->question.type == DNS::QUERY_PTR)
 		{
 			UserResolver* res_forward;
-			if (bound_user->client_sa.family() == AF_INET6)
+			if (sa.family() == AF_INET6)
 			{
 				/* IPV6 forward lookup */
-				res_forward = new UserResolver(this->manager, this->creator, bound_user, ans_record->rdata, DNS::QUERY_AAAA);
+				res_forward = new UserResolver(this->manager, this->creator, pipeline, sa, ans_record->rdata, DNS::QUERY_AAAA, ans_record->ttl);
 			}
 			else
 			{
 				/* IPV4 lookup */
-				res_forward = new UserResolver(this->manager, this->creator, bound_user, ans_record->rdata, DNS::QUERY_A);
+				res_forward = new UserResolver(this->manager, this->creator, pipeline, sa, ans_record->rdata, DNS::QUERY_A, ans_record->ttl);
 			}
 			try
 			{
@@ -108,21 +248,19 @@ class UserResolver : public DNS::Request
 				delete res_forward;
 				ServerInstance->Logs.Log(MODNAME, LOG_DEBUG, "Error in resolver: " + e.GetReason());
 
-				HandleError(bound_user, "There was an internal error resolving your host");
+				HandleError("There was an internal error resolving your host", false);
 			}
 		}
 		else if (this->question.type == DNS::QUERY_A || this->question.type == DNS::QUERY_AAAA)
 		{
 			/* Both lookups completed */
-
-			irc::sockets::sockaddrs* user_ip = &bound_user->client_sa;
 			bool rev_match = false;
-			if (user_ip->family() == AF_INET6)
+			if (sa.family() == AF_INET6)
 			{
 				struct in6_addr res_bin;
 				if (inet_pton(AF_INET6, ans_record->rdata.c_str(), &res_bin))
 				{
-					rev_match = !memcmp(&user_ip->in6.sin6_addr, &res_bin, sizeof(res_bin));
+					rev_match = !memcmp(&sa.in6.sin6_addr, &res_bin, sizeof(res_bin));
 				}
 			}
 			else
@@ -130,20 +268,18 @@ class UserResolver : public DNS::Request
 				struct in_addr res_bin;
 				if (inet_pton(AF_INET, ans_record->rdata.c_str(), &res_bin))
 				{
-					rev_match = !memcmp(&user_ip->in4.sin_addr, &res_bin, sizeof(res_bin));
+					rev_match = !memcmp(&sa.in4.sin_addr, &res_bin, sizeof(res_bin));
 				}
 			}
 
 			if (rev_match)
 			{
-				bound_user->WriteNotice("*** Found your hostname (" + this->question.name + (r->cached ? ") -- cached" : ")"));
-				bool display_is_real = bound_user->GetDisplayedHost() == bound_user->GetRealHost();
-				bound_user->ChangeRealHost(this->question.name, display_is_real);
-				dl->unset(bound_user);
+				const unsigned int ttl = std::min({ ptrttl, ans_record->ttl, MAX_POSITIVE_TTL });
+				pipeline.Finish(ip, this->question.name, "", ttl, r->cached);
 			}
 			else
 			{
-				HandleError(bound_user, "Your hostname does not match up with your IP address");
+				HandleError("Your hostname does not match up with your IP address", true);
 			}
 		}
 	}
@@ -153,21 +289,24 @@ class UserResolver : public DNS::Request
 	 */
 	void OnError(const DNS::Query* query) override
 	{
-		LocalUser* bound_user = IS_LOCAL(ServerInstance->Users.FindUUID(uuid));
-		if (bound_user)
-			HandleError(bound_user, "Could not resolve your hostname: " + this->manager->GetErrorStr(query->error));
+		const bool definitive = query->error == DNS::ERROR_DOMAIN_NOT_FOUND || query->error == DNS::ERROR_NO_RECORDS;
+		HandleError("Could not resolve your hostname: " + this->manager->GetErrorStr(query->error), definitive);
 	}
 };
 
-class ModuleHostnameLookup : public Module
+class ModuleHostnameLookup
+	: public Module
+	, public Stats::EventListener
 {
  private:
 	IntExtItem dnsLookup;
 	dynamic_reference<DNS::Manager> DNS;
+	LookupPipeline pipeline;
 
  public:
 	ModuleHostnameLookup()
 		: Module(VF_CORE | VF_VENDOR, "Provides support for DNS lookups on connecting clients")
+		, Stats::EventListener(this)
 		, dnsLookup(this, "dnsLookup", ExtensionItem::EXT_USER)
 		, DNS(this, "DNS")
 	{
@@ -187,18 +326,46 @@ class ModuleHostnameLookup : public Module
 
 		user->WriteNotice("*** Looking up your hostname...");
 
-		UserResolver* res_reverse = new UserResolver(*this->DNS, this, user, user->GetIPString(), DNS::QUERY_PTR);
+		// If we already know the hostname of this IP address we can skip the lookup entirely.
+		const std::string& ip = user->GetIPString();
+		auto result = pipeline.results.find(ip);
+		if (result != pipeline.results.end())
+		{
+			if (result->second.expiry > ServerInstance->Time())
+			{
+				pipeline.cachehits++;
+				LookupPipeline::Apply(user, result->second, true);
+				return;
+			}
+			pipeline.results.erase(result);
+		}
+
+		// If another user from this IP address is being looked up then wait for that instead.
+		this->dnsLookup.set(user, 1);
+		auto pending = pipeline.pending.find(ip);
+		if (pending != pipeline.pending.end())
+		{
+			pipeline.coalesced++;
+			pending->second.users.push_back(user->uuid);
+			return;
+		}
+
+		PendingLookup& lookup = pipeline.pending[ip];
+		lookup.users.push_back(user->uuid);
+		lookup.started = NowMillis();
+
+		UserResolver* res_reverse = new UserResolver(*this->DNS, this, pipeline, user->client_sa, ip, DNS::QUERY_PTR);
 		try
 		{
 			/* If both the reverse and forward queries are cached, the user will be able to pass DNS completely
-			 * before Process() completes, which is why dnsLookup.set() is here, before Process()
+			 * before Process() completes, which is why dnsLookup.set() is above, before Process()
 			 */
-			this->dnsLookup.set(user, 1);
 			this->DNS->Process(res_reverse);
 		}
 		catch (DNS::Exception& e)
 		{
 			this->dnsLookup.unset(user);
+			pipeline.pending.erase(ip);
 			delete res_reverse;
 			ServerInstance->Logs.Log(MODNAME, LOG_DEBUG, "Error in resolver: " + e.GetReason());
 		}
@@ -208,6 +375,29 @@ class ModuleHostnameLookup : public Module
 	{
 		return this->dnsLookup.get(user) ? MOD_RES_DENY : MOD_RES_PASSTHRU;
 	}
+
+	void OnBackgroundTimer(time_t) override
+	{
+		pipeline.Prune();
+	}
+
+	ModResult OnStats(Stats::Context& stats) override
+	{
+		if (stats.GetSymbol() != 'T')
+			return MOD_RES_PASSTHRU;
+
+		size_t waiting = 0;
+		for (const auto& [_, lookup] : pipeline.pending)
+			waiting += lookup.users.size();
+
+		stats.AddRow(249, InspIRCd::Format("hostname lookups pending %zu waiting users %zu cached results %zu",
+			pipeline.pending.size(), waiting, pipeline.results.size()));
+		stats.AddRow(249, InspIRCd::Format("hostname lookups completed %lu cache hits %lu coalesced %lu latency avg %lums max %lums",
+			pipeline.completed, pipeline.cachehits, pipeline.coalesced,
+			static_cast<unsigned long>(pipeline.completed ? pipeline.totallatency / pipeline.completed : 0),
+			static_cast<unsigned long>(pipeline.maxlatency)));
+		return MOD_RES_PASSTHRU;
+	}
 };
 
 MODULE_INIT(ModuleHostnameLookup)
@@ -50,19 +50,33 @@ CmdResult CommandMotd::Handle(User* user, const Params& parameters)
 		tag = localuser->GetClass()->config;
 
 	const std::string motd_name = tag->getString("motd", "motd", 1);
-	ConfigFileCache::iterator motd = motds.find(motd_name);
+	MotdCache::iterator motd = motds.find(motd_name);
 	if (motd == motds.end())
 	{
 		user->WriteRemoteNumeric(ERR_NOMOTD, "Message of the day file is missing.");
 		return CmdResult::SUCCESS;
 	}
 
-	user->WriteRemoteNumeric(RPL_MOTDSTART, InspIRCd::Format("%s message of the day", ServerInstance->Config->GetServerName().c_str()));
+	for (const auto& numeric : motd->second)
+		user->WriteRemoteNumeric(numeric);
 
-	for (file_cache::iterator i = motd->second.begin(); i != motd->second.end(); i++)
-		user->WriteRemoteNumeric(RPL_MOTD, InspIRCd::Format(" %s", i->c_str()));
+	return CmdResult::SUCCESS;
+}
 
-	user->WriteRemoteNumeric(RPL_ENDOFMOTD, "End of message of the day.");
+void CommandMotd::Render(const std::string& name, const file_cache& contents, MotdCache& cache)
+{
+	std::vector<Numeric::Numeric>& numerics = cache[name];
+	numerics.reserve(contents.size() + 2);
 
-	return CmdResult::SUCCESS;
+	numerics.push_back(Numeric::Numeric(RPL_MOTDSTART));
+	numerics.back().push(InspIRCd::Format("%s message of the day", ServerInstance->Config->GetServerName().c_str()));
+
+	for (const auto& line : contents)
+	{
+		numerics.push_back(Numeric::Numeric(RPL_MOTD));
+		numerics.back().push(" " + line);
+	}
+
+	numerics.push_back(Numeric::Numeric(RPL_ENDOFMOTD));
+	numerics.back().push("End of message of the day.");
 }
@@ -49,6 +49,8 @@ class CoreModInfo : public Module
 	CommandServList cmdservlist;
 	CommandTime cmdtime;
 	CommandVersion cmdversion;
+	Numeric::Numeric numeric002;
+	Numeric::Numeric numeric003;
 	Numeric::Numeric numeric004;
 	ISupportManager isupport;
 
@@ -98,6 +100,8 @@ class CoreModInfo : public Module
 		, cmdservlist(this)
 		, cmdtime(this)
 		, cmdversion(this, isupport)
+		, numeric002(RPL_YOURHOST)
+		, numeric003(RPL_CREATED)
 		, numeric004(RPL_MYINFO)
 		, isupport(this)
 	{
@@ -107,8 +111,8 @@ class CoreModInfo : public Module
 
 	void ReadConfig(ConfigStatus& status) override
 	{
-		// Process the escape codes in the MOTDs.
-		ConfigFileCache newmotds;
+		// Process the escape codes in the MOTDs and render them into numerics.
+		CommandMotd::MotdCache newmotds;
 		for (ServerConfig::ClassVector::const_iterator iter = ServerInstance->Config->Classes.begin(); iter != ServerInstance->Config->Classes.end(); ++iter)
 		{
 			std::shared_ptr<ConfigTag> tag = (*iter)->config;
@@ -123,12 +127,19 @@ class CoreModInfo : public Module
 				continue;
 
 			// Process escape codes.
-			newmotds[file->first] = file->second;
-			InspIRCd::ProcessColors(newmotds[file->first]);
+			file_cache contents = file->second;
+			InspIRCd::ProcessColors(contents);
+			CommandMotd::Render(file->first, contents, newmotds);
 		}
 
 		cmdmotd.motds.swap(newmotds);
 
+		// The server name shown to users can change on rehash so these are rendered here.
+		numeric002.GetParams().clear();
+		numeric002.push(InspIRCd::Format("Your host is %s, running version %s", ServerInstance->Config->GetServerName().c_str(), INSPIRCD_BRANCH));
+		numeric003.GetParams().clear();
+		numeric003.push(InspIRCd::TimeString(ServerInstance->startup_time, "This server was created %H:%M:%S %b %d %Y"));
+
 		auto tag = ServerInstance->Config->ConfValue("admin");
 		cmdadmin.AdminName = tag->getString("name");
 		cmdadmin.AdminEmail = tag->getString("email", "null@example.com");
@@ -140,8 +151,8 @@ class CoreModInfo : public Module
 	void OnUserConnect(LocalUser* user) override
 	{
 		user->WriteNumeric(RPL_WELCOME, InspIRCd::Format("Welcome to the %s IRC Network %s", ServerInstance->Config->Network.c_str(), user->GetFullRealHost().c_str()));
-		user->WriteNumeric(RPL_YOURHOST, InspIRCd::Format("Your host is %s, running version %s", ServerInstance->Config->GetServerName().c_str(), INSPIRCD_BRANCH));
-		user->WriteNumeric(RPL_CREATED, InspIRCd::TimeString(ServerInstance->startup_time, "This server was created %H:%M:%S %b %d %Y"));
+		user->WriteNumeric(numeric002);
+		user->WriteNumeric(numeric003);
 		user->WriteNumeric(numeric004);
 		isupport.SendTo(user);
 
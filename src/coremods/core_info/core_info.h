@@ -164,12 +164,23 @@ class CommandModules : public ServerTargetCommand
 class CommandMotd : public ServerTargetCommand
 {
  public:
-	ConfigFileCache motds;
+	/** The MOTD numerics which are sent to users keyed by the name of the MOTD file. */
+	typedef std::map<std::string, std::vector<Numeric::Numeric>> MotdCache;
+
+	/** The pre-rendered MOTDs which are used by the connect classes. */
+	MotdCache motds;
 
 	/** Constructor for motd.
 	 */
 	CommandMotd(Module* parent);
 
+	/** Renders the contents of a MOTD file into the numerics that are sent to users.
+	 * @param name The name of the MOTD file.
+	 * @param contents The contents of the MOTD file with the escape codes already processed.
+	 * @param cache The cache to store the rendered numerics in.
+	 */
+	static void Render(const std::string& name, const file_cache& contents, MotdCache& cache);
+
 	/** Handle command.
 	 * @param parameters The parameters to the command
 	 * @param user The user issuing the command
@@ -73,6 +73,13 @@ class CommandList : public Command
  */
 CmdResult CommandList::Handle(User* user, const Params& parameters)
 {
+	LocalUser* const localuser = IS_LOCAL(user);
+	if (localuser && ServerInstance->Users.ThrottleOutput(localuser))
+	{
+		user->WriteNumeric(RPL_TRYAGAIN, name, "Server load is temporarily too heavy. Please wait a while and try again.");
+		return CmdResult::FAILURE;
+	}
+
 	// C: Searching based on creation time, via the "C<val" and "C>val" modifiers
 	// to search for a channel creation time that is lower or higher than val
 	// respectively.
@@ -190,7 +197,7 @@ CmdResult CommandList::Handle(User* user, const Params& parameters)
 			else if (showmodes)
 			{
 				// Show the list response with the modes and topic.
-				user->WriteNumeric(RPL_LIST, chan->name, users, InspIRCd::Format("[+%s] %s", chan->ChanModes(n), chan->topic.c_str()));
+				user->WriteNumeric(RPL_LIST, chan->name, users, InspIRCd::Format("[+%s] %s", chan->ChanModes(n).c_str(), chan->topic.c_str()));
 			}
 			else
 			{
@@ -25,6 +25,7 @@
 
 
 #include "inspircd.h"
+#include "modules/server.h"
 
 struct LusersCounters
 {
@@ -32,6 +33,12 @@ struct LusersCounters
 	unsigned int max_global;
 	unsigned int invisible = 0;
 
+	/** The number of servers on the network or 0 if they need to be counted again. */
+	unsigned int servers = 0;
+
+	/** The number of servers which are directly linked to this server. */
+	unsigned int local_servers = 0;
+
 	LusersCounters(UserModeReference& invisiblemode)
 		: max_local(ServerInstance->Users.LocalUserCount())
 		, max_global(ServerInstance->Users.RegisteredUserCount())
@@ -45,6 +52,25 @@ struct LusersCounters
 		}
 	}
 
+	void UpdateServers()
+	{
+		// Building the server list is expensive on large networks so we only
+		// do it when the network topology has changed.
+		ProtocolInterface::ServerList serverlist;
+		ServerInstance->PI->GetServerList(serverlist);
+		servers = serverlist.size();
+		local_servers = 0;
+		for (ProtocolInterface::ServerList::const_iterator i = serverlist.begin(); i != serverlist.end(); ++i)
+		{
+			if (i->parentname == ServerInstance->Config->ServerName)
+				local_servers++;
+		}
+
+		// fix for default GetServerList not returning us
+		if (!servers)
+			servers = 1;
+	}
+
 	inline void UpdateMaxUsers()
 	{
 		unsigned int current = ServerInstance->Users.LocalUserCount();
@@ -81,18 +107,10 @@ class CommandLusers : public Command
 CmdResult CommandLusers::Handle(User* user, const Params& parameters)
 {
 	unsigned int n_users = ServerInstance->Users.RegisteredUserCount();
-	ProtocolInterface::ServerList serverlist;
-	ServerInstance->PI->GetServerList(serverlist);
-	unsigned int n_serv = serverlist.size();
-	unsigned int n_local_servs = 0;
-	for (ProtocolInterface::ServerList::const_iterator i = serverlist.begin(); i != serverlist.end(); ++i)
-	{
-		if (i->parentname == ServerInstance->Config->ServerName)
-			n_local_servs++;
-	}
-	// fix for default GetServerList not returning us
-	if (!n_serv)
-		n_serv = 1;
+	if (!counters.servers)
+		counters.UpdateServers();
+	unsigned int n_serv = counters.servers;
+	unsigned int n_local_servs = counters.local_servers;
 
 	counters.UpdateMaxUsers();
 
@@ -138,7 +156,9 @@ public:
 	}
 };
 
-class ModuleLusers : public Module
+class ModuleLusers
+	: public Module
+	, public ServerProtocol::LinkEventListener
 {
 	UserModeReference invisiblemode;
 	LusersCounters counters;
@@ -148,6 +168,7 @@ class ModuleLusers : public Module
  public:
 	ModuleLusers()
 		: Module(VF_CORE | VF_VENDOR, "Provides the LUSERS command")
+		, ServerProtocol::LinkEventListener(this)
 		, invisiblemode(this, "invisible")
 		, counters(invisiblemode)
 		, cmd(this, counters)
@@ -167,6 +188,22 @@ class ModuleLusers : public Module
 		if (!user->server->IsULine() && user->IsModeSet(invisiblemode))
 			counters.invisible--;
 	}
+
+	void OnServerLink(const Server* server) override
+	{
+		counters.servers = 0;
+	}
+
+	void OnServerSplit(const Server* server, bool error) override
+	{
+		counters.servers = 0;
+	}
+
+	void OnUnloadModule(Module* mod) override
+	{
+		// The protocol module may have been unloaded.
+		counters.servers = 0;
+	}
 };
 
 MODULE_INIT(ModuleLusers)
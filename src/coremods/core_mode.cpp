@@ -204,38 +204,11 @@ namespace
 		// the user is a member of the channel.
 		bool show_secret = chan->HasUser(user);
 
-		size_t modepos = num.push("+").GetParams().size() - 1;
-		std::string modes;
-		std::string param;
-		for (unsigned char chr = 65; chr < 123; ++chr)
-		{
-			// Check that the mode exists and is set.
-			ModeHandler* mh = ServerInstance->Modes.FindMode(chr, MODETYPE_CHANNEL);
-			if (!mh || !chan->IsModeSet(mh))
-				continue;
-
-			// Add the mode to the set list.
-			modes.push_back(mh->GetModeChar());
-
-			// If the mode has a parameter we need to include that too.
-			ParamModeBase* pm = mh->IsParameterMode();
-			if (!pm)
-				continue;
-
-			// If a mode has a secret parameter and the user is not privy to
-			// the value of it then we use <name> instead of the value.
-			if (pm->IsParameterSecret() && !show_secret)
-			{
-				num.push("<" + pm->name + ">");
-				continue;
-			}
-
-			// Retrieve the parameter and add it to the mode list.
-			pm->GetParameter(chan, param);
+		// Each parameter is sent as a separate numeric parameter.
+		const Channel::ModeList& modes = chan->GetModeList(show_secret);
+		num.push("+" + modes.letters);
+		for (const auto& param : modes.params)
 			num.push(param);
-			param.clear();
-		}
-		num.GetParams()[modepos].append(modes);
 	}
 }
 
@@ -117,34 +117,43 @@ class DataKeeper
 		 */
 		size_t index;
 
-		/** Serialized data
+		/** Position of the serialized data in the arena
 		 */
-		std::string serialized;
+		size_t offset;
 
-		InstanceData(size_t Index, const std::string& Serialized)
+		/** Length of the serialized data
+		 */
+		size_t length;
+
+		InstanceData(size_t Index, size_t Offset, size_t Length)
 			: index(Index)
-			, serialized(Serialized)
+			, offset(Offset)
+			, length(Length)
 		{
 		}
 	};
 
+	/** A range of entries in one of the lists owned by the DataKeeper
+	 */
+	struct Range
+	{
+		size_t first = 0;
+		size_t last = 0;
+
+		bool empty() const { return first == last; }
+	};
+
 	struct ModesExts
 	{
-		/** Mode data for the object, one entry per mode set by the module being reloaded
+		/** Mode data for the object, one entry in the instance list per mode set by the module being reloaded
 		 */
-		std::vector<InstanceData> modelist;
+		Range modes;
 
-		/** Extensions for the object, one entry per extension set by the module being reloaded
+		/** Extensions for the object, one entry in the instance list per extension set by the module being reloaded
 		 */
-		std::vector<InstanceData> extlist;
+		Range exts;
 
-		bool empty() const { return ((modelist.empty()) && (extlist.empty())); }
-
-		void swap(ModesExts& other)
-		{
-			modelist.swap(other.modelist);
-			extlist.swap(other.extlist);
-		}
+		bool empty() const { return ((modes.empty()) && (exts.empty())); }
 	};
 
 	struct OwnedModesExts : public ModesExts
@@ -153,8 +162,9 @@ class DataKeeper
 		 */
 		std::string owner;
 
-		OwnedModesExts(const std::string& Owner)
-			: owner(Owner)
+		OwnedModesExts(const std::string& Owner, const ModesExts& data)
+			: ModesExts(data)
+			, owner(Owner)
 		{
 		}
 	};
@@ -166,12 +176,13 @@ class DataKeeper
 		 */
 		typedef OwnedModesExts MemberData;
 
-		/** List of data (modes and extensions) about each member
+		/** Data (modes and extensions) about each member, one entry in the member list per member
 		 */
-		std::vector<MemberData> memberdatalist;
+		Range members;
 
-		ChanData(Channel* chan)
-			: OwnedModesExts(chan->name)
+		ChanData(Channel* chan, const ModesExts& data, const Range& memberrange)
+			: OwnedModesExts(chan->name, data)
+			, members(memberrange)
 		{
 		}
 	};
@@ -182,8 +193,8 @@ class DataKeeper
 		static const size_t UNUSED_INDEX = (size_t)-1;
 		size_t serializerindex;
 
-		UserData(User* user, size_t serializeridx)
-			: OwnedModesExts(user->uuid)
+		UserData(User* user, const ModesExts& data, size_t serializeridx)
+			: OwnedModesExts(user->uuid, data)
 			, serializerindex(serializeridx)
 		{
 		}
@@ -209,17 +220,41 @@ class DataKeeper
 	 */
 	std::vector<UserData> userdatalist;
 
-	/** Stores all of the module data related to channels and memberships
+	/** Stores all of the module data related to channels
 	 */
 	std::vector<ChanData> chandatalist;
 
+	/** Stores all of the module data related to memberships
+	 */
+	std::vector<ChanData::MemberData> memberdatalist;
+
+	/** Stores all of the modes and extensions saved for users, channels and memberships
+	 */
+	std::vector<InstanceData> instances;
+
+	/** Stores the serialized data of all instances back to back
+	 */
+	std::string arena;
+
 	/** Data attached by modules
 	 */
 	ReloadModule::CustomData moddata;
 
-	void SaveExtensions(Extensible* extensible, std::vector<InstanceData>& extdatalist);
-	void SaveMemberData(Channel* chan, std::vector<ChanData::MemberData>& memberdatalist);
-	static void SaveListModes(Channel* chan, ListModeBase* lm, size_t index, ModesExts& currdata);
+	/** Saves an instance of a mode or extension
+	 * @param index Position of the ModeHandler or ExtensionItem that the data belongs to
+	 * @param serialized Serialized data
+	 */
+	void SaveInstance(size_t index, const std::string& serialized);
+
+	/** Retrieve the serialized data of an instance
+	 * @param id Instance whose data to retrieve
+	 * @return Serialized data
+	 */
+	std::string GetSerialized(const InstanceData& id) const { return arena.substr(id.offset, id.length); }
+
+	void SaveExtensions(Extensible* extensible, Range& extrange);
+	Range SaveMemberData(Channel* chan);
+	void SaveListModes(Channel* chan, ListModeBase* lm, size_t index);
 	size_t SaveSerializer(User* user);
 
 	/** Get the index of a ProviderInfo representing the serializer in the handledserializers list.
@@ -258,20 +293,20 @@ class DataKeeper
 	 * (for Channels and Memberships).
 	 * @param modechange Mode change to populate with the modes
 	 */
-	void RestoreObj(const OwnedModesExts& data, Extensible* extensible, ModeType modetype, Modes::ChangeList& modechange);
+	void RestoreObj(const ModesExts& data, Extensible* extensible, ModeType modetype, Modes::ChangeList& modechange);
 
 	/** Restore all previously saved extensions on an Extensible
-	 * @param list List of extensions and their serialized data to restore
+	 * @param range Range of the instance list containing the extensions to restore
 	 * @param extensible Target Extensible
 	 */
-	void RestoreExtensions(const std::vector<InstanceData>& list, Extensible* extensible);
+	void RestoreExtensions(const Range& range, Extensible* extensible);
 
 	/** Restore all previously saved modes on a User, Channel or Membership
-	 * @param list List of modes to restore
+	 * @param range Range of the instance list containing the modes to restore
 	 * @param modetype MODETYPE_USER if the object being restored is a User, MODETYPE_CHANNEL otherwise
 	 * @param modechange Mode change to populate with the modes
 	 */
-	void RestoreModes(const std::vector<InstanceData>& list, ModeType modetype, Modes::ChangeList& modechange);
+	void RestoreModes(const Range& range, ModeType modetype, Modes::ChangeList& modechange);
 
 	/** Restore previously saved serializer on a User.
 	 * Quit the user if the serializer cannot be restored.
@@ -284,10 +319,10 @@ class DataKeeper
 
 	/** Restore all modes and extensions of all members on a channel
 	 * @param chan Channel whose members are being restored
-	 * @param memberdata Data to restore
+	 * @param range Range of the member list containing the data to restore
 	 * @param modechange Mode change to populate with prefix modes
 	 */
-	void RestoreMemberData(Channel* chan, const std::vector<ChanData::MemberData>& memberdatalist, Modes::ChangeList& modechange);
+	void RestoreMemberData(Channel* chan, const Range& range, Modes::ChangeList& modechange);
 
 	/** Verify that a service which had its data saved is available and owned by the module that owned it previously
 	 * @param service Service descriptor
@@ -311,6 +346,12 @@ class DataKeeper
 	void Fail();
 };
 
+void DataKeeper::SaveInstance(size_t index, const std::string& serialized)
+{
+	instances.push_back(InstanceData(index, arena.length(), serialized.length()));
+	arena.append(serialized);
+}
+
 void DataKeeper::DoSaveUsers()
 {
 	ModesExts currdata;
@@ -321,15 +362,17 @@ void DataKeeper::DoSaveUsers()
 		User* const user = i->second;
 
 		// Serialize user modes
+		currdata.modes.first = instances.size();
 		for (size_t j = 0; j < handledmodes[MODETYPE_USER].size(); j++)
 		{
 			ModeHandler* mh = handledmodes[MODETYPE_USER][j].mh;
 			if (user->IsModeSet(mh))
-				currdata.modelist.push_back(InstanceData(j, mh->GetUserParameter(user)));
+				SaveInstance(j, mh->GetUserParameter(user));
 		}
+		currdata.modes.last = instances.size();
 
 		// Serialize all extensions attached to the User
-		SaveExtensions(user, currdata.extlist);
+		SaveExtensions(user, currdata.exts);
 
 		// Save serializer name if applicable and get an index to it
 		size_t serializerindex = SaveSerializer(user);
@@ -338,8 +381,7 @@ void DataKeeper::DoSaveUsers()
 		// have to do anything with this user when restoring
 		if ((!currdata.empty()) || (serializerindex != UserData::UNUSED_INDEX))
 		{
-			userdatalist.push_back(UserData(user, serializerindex));
-			userdatalist.back().swap(currdata);
+			userdatalist.push_back(UserData(user, currdata, serializerindex));
 		}
 	}
 }
@@ -369,9 +411,12 @@ size_t DataKeeper::SaveSerializer(User* user)
 	return serializerindex;
 }
 
-void DataKeeper::SaveExtensions(Extensible* extensible, std::vector<InstanceData>& extdata)
+void DataKeeper::SaveExtensions(Extensible* extensible, Range& extrange)
 {
 	const Extensible::ExtensibleStore& setexts = extensible->GetExtList();
+	extrange.first = extrange.last = instances.size();
+	if (setexts.empty())
+		return;
 
 	// Position of the extension saved in the handledexts list
 	size_t index = 0;
@@ -385,11 +430,12 @@ void DataKeeper::SaveExtensions(Extensible* extensible, std::vector<InstanceData
 		std::string value = item->ToInternal(extensible, it->second);
 		// If the serialized value is empty the extension won't be saved and restored
 		if (!value.empty())
-			extdata.push_back(InstanceData(index, value));
+			SaveInstance(index, value);
 	}
+	extrange.last = instances.size();
 }
 
-void DataKeeper::SaveListModes(Channel* chan, ListModeBase* lm, size_t index, ModesExts& currdata)
+void DataKeeper::SaveListModes(Channel* chan, ListModeBase* lm, size_t index)
 {
 	const ListModeBase::ModeList* list = lm->GetList(chan);
 	if (!list)
@@ -398,14 +444,13 @@ void DataKeeper::SaveListModes(Channel* chan, ListModeBase* lm, size_t index, Mo
 	for (ListModeBase::ModeList::const_iterator i = list->begin(); i != list->end(); ++i)
 	{
 		const ListModeBase::ListItem& listitem = *i;
-		currdata.modelist.push_back(InstanceData(index, listitem.mask));
+		SaveInstance(index, listitem.mask);
 	}
 }
 
 void DataKeeper::DoSaveChans()
 {
 	ModesExts currdata;
-	std::vector<OwnedModesExts> currmemberdata;
 
 	const chan_hash& chans = ServerInstance->GetChans();
 	for (chan_hash::const_iterator i = chans.begin(); i != chans.end(); ++i)
@@ -413,64 +458,71 @@ void DataKeeper::DoSaveChans()
 		Channel* const chan = i->second;
 
 		// Serialize channel modes
+		currdata.modes.first = instances.size();
 		for (size_t j = 0; j < handledmodes[MODETYPE_CHANNEL].size(); j++)
 		{
 			ModeHandler* mh = handledmodes[MODETYPE_CHANNEL][j].mh;
 			ListModeBase* lm = mh->IsListModeBase();
 			if (lm)
-				SaveListModes(chan, lm, j, currdata);
+				SaveListModes(chan, lm, j);
 			else if (chan->IsModeSet(mh))
-				currdata.modelist.push_back(InstanceData(j, chan->GetModeParameter(mh)));
+				SaveInstance(j, chan->GetModeParameter(mh));
 		}
+		currdata.modes.last = instances.size();
 
 		// Serialize all extensions attached to the Channel
-		SaveExtensions(chan, currdata.extlist);
+		SaveExtensions(chan, currdata.exts);
 
 		// Serialize all extensions attached to and all modes set on all members of the channel
-		SaveMemberData(chan, currmemberdata);
+		const Range members = SaveMemberData(chan);
 
 		// Same logic as in DoSaveUsers() plus we consider the modes and extensions of all members
-		if ((!currdata.empty()) || (!currmemberdata.empty()))
+		if ((!currdata.empty()) || (!members.empty()))
 		{
-			chandatalist.push_back(ChanData(chan));
-			chandatalist.back().swap(currdata);
-			chandatalist.back().memberdatalist.swap(currmemberdata);
+			chandatalist.push_back(ChanData(chan, currdata, members));
 		}
 	}
 }
 
-void DataKeeper::SaveMemberData(Channel* chan, std::vector<OwnedModesExts>& memberdatalist)
+DataKeeper::Range DataKeeper::SaveMemberData(Channel* chan)
 {
+	Range members;
+	members.first = memberdatalist.size();
+
 	ModesExts currdata;
 	const Channel::MemberMap& users = chan->GetUsers();
 	for (Channel::MemberMap::const_iterator i = users.begin(); i != users.end(); ++i)
 	{
 		Membership* const memb = i->second;
 
+		currdata.modes.first = instances.size();
 		for (size_t j = 0; j < handledmodes[MODETYPE_CHANNEL].size(); j++)
 		{
 			ModeHandler* mh = handledmodes[MODETYPE_CHANNEL][j].mh;
 			const PrefixMode* const pm = mh->IsPrefixMode();
 			if ((pm) && (memb->HasMode(pm)))
-				currdata.modelist.push_back(InstanceData(j, memb->user->uuid)); // Need to pass the user's uuid to the mode parser to set the mode later
+				SaveInstance(j, memb->user->uuid); // Need to pass the user's uuid to the mode parser to set the mode later
 		}
+		currdata.modes.last = instances.size();
 
-		SaveExtensions(memb, currdata.extlist);
+		SaveExtensions(memb, currdata.exts);
 
 		// Same logic as in DoSaveUsers()
 		if (!currdata.empty())
 		{
-			memberdatalist.push_back(OwnedModesExts(memb->user->uuid));
-			memberdatalist.back().swap(currdata);
+			memberdatalist.push_back(OwnedModesExts(memb->user->uuid, currdata));
 		}
 	}
+
+	members.last = memberdatalist.size();
+	return members;
 }
 
-void DataKeeper::RestoreMemberData(Channel* chan, const std::vector<ChanData::MemberData>& memberdatalist, Modes::ChangeList& modechange)
+void DataKeeper::RestoreMemberData(Channel* chan, const Range& range, Modes::ChangeList& modechange)
 {
-	for (std::vector<ChanData::MemberData>::const_iterator i = memberdatalist.begin(); i != memberdatalist.end(); ++i)
+	for (size_t i = range.first; i != range.last; ++i)
 	{
-		const ChanData::MemberData& md = *i;
+		const ChanData::MemberData& md = memberdatalist[i];
 		User* const user = ServerInstance->Users.FindUUID(md.owner);
 		if (!user)
 		{
@@ -589,27 +641,27 @@ void DataKeeper::Fail()
 	DoRestoreModules();
 }
 
-void DataKeeper::RestoreObj(const OwnedModesExts& data, Extensible* extensible, ModeType modetype, Modes::ChangeList& modechange)
+void DataKeeper::RestoreObj(const ModesExts& data, Extensible* extensible, ModeType modetype, Modes::ChangeList& modechange)
 {
-	RestoreExtensions(data.extlist, extensible);
-	RestoreModes(data.modelist, modetype, modechange);
+	RestoreExtensions(data.exts, extensible);
+	RestoreModes(data.modes, modetype, modechange);
 }
 
-void DataKeeper::RestoreExtensions(const std::vector<InstanceData>& list, Extensible* extensible)
+void DataKeeper::RestoreExtensions(const Range& range, Extensible* extensible)
 {
-	for (std::vector<InstanceData>::const_iterator i = list.begin(); i != list.end(); ++i)
+	for (size_t i = range.first; i != range.last; ++i)
 	{
-		const InstanceData& id = *i;
-		handledexts[id.index].extitem->FromInternal(extensible, id.serialized);
+		const InstanceData& id = instances[i];
+		handledexts[id.index].extitem->FromInternal(extensible, GetSerialized(id));
 	}
 }
 
-void DataKeeper::RestoreModes(const std::vector<InstanceData>& list, ModeType modetype, Modes::ChangeList& modechange)
+void DataKeeper::RestoreModes(const Range& range, ModeType modetype, Modes::ChangeList& modechange)
 {
-	for (std::vector<InstanceData>::const_iterator i = list.begin(); i != list.end(); ++i)
+	for (size_t i = range.first; i != range.last; ++i)
 	{
-		const InstanceData& id = *i;
-		modechange.push_add(handledmodes[modetype][id.index].mh, id.serialized);
+		const InstanceData& id = instances[i];
+		modechange.push_add(handledmodes[modetype][id.index].mh, GetSerialized(id));
 	}
 }
 
@@ -657,6 +709,9 @@ void DataKeeper::DoRestoreUsers()
 			continue;
 
 		RestoreObj(userdata, user, MODETYPE_USER, modechange);
+		if (modechange.empty())
+			continue;
+
 		ServerInstance->Modes.Process(ServerInstance->FakeClient, NULL, user, modechange, ModeParser::MODE_LOCALONLY);
 		modechange.clear();
 	}
@@ -679,13 +734,19 @@ void DataKeeper::DoRestoreChans()
 
 		RestoreObj(chandata, chan, MODETYPE_CHANNEL, modechange);
 		// Process the mode change before applying any prefix modes
-		ServerInstance->Modes.Process(ServerInstance->FakeClient, chan, NULL, modechange, ModeParser::MODE_LOCALONLY);
-		modechange.clear();
+		if (!modechange.empty())
+		{
+			ServerInstance->Modes.Process(ServerInstance->FakeClient, chan, NULL, modechange, ModeParser::MODE_LOCALONLY);
+			modechange.clear();
+		}
 
 		// Restore all member data
-		RestoreMemberData(chan, chandata.memberdatalist, modechange);
-		ServerInstance->Modes.Process(ServerInstance->FakeClient, chan, NULL, modechange, ModeParser::MODE_LOCALONLY);
-		modechange.clear();
+		RestoreMemberData(chan, chandata.members, modechange);
+		if (!modechange.empty())
+		{
+			ServerInstance->Modes.Process(ServerInstance->FakeClient, chan, NULL, modechange, ModeParser::MODE_LOCALONLY);
+			modechange.clear();
+		}
 	}
 }
 
@@ -45,6 +45,7 @@ class RFCSerializer : public ClientProtocol::Serializer
 
  	bool Parse(LocalUser* user, const std::string& line, ClientProtocol::ParseOutput& parseoutput) override;
 	ClientProtocol::SerializedMessage Serialize(const ClientProtocol::Message& msg, const ClientProtocol::TagSelection& tagwl) const override;
+	bool SerializeNumeric(LocalUser* user, const Numeric::Numeric& numeric, std::string& out) const override;
 };
 
 bool RFCSerializer::Parse(LocalUser* user, const std::string& line, ClientProtocol::ParseOutput& parseoutput)
@@ -223,6 +224,43 @@ ClientProtocol::SerializedMessage RFCSerializer::Serialize(const ClientProtocol:
 	return line;
 }
 
+bool RFCSerializer::SerializeNumeric(LocalUser* user, const Numeric::Numeric& numeric, std::string& out) const
+{
+	// This must produce exactly the same output as Serialize() does for a Messages::Numeric.
+	out.clear();
+	out.push_back(':');
+	out.append((numeric.GetServer() ? numeric.GetServer() : ServerInstance->FakeClient->server)->GetName());
+
+	char numericstr[5];
+	snprintf(numericstr, sizeof(numericstr), " %03u", numeric.GetNumeric());
+	out.append(numericstr);
+
+	const std::vector<std::string>& params = numeric.GetParams();
+	out.append(params.empty() ? " :" : " ");
+	if (user->registered & REG_NICK)
+		out.append(user->nick);
+	else
+		out.push_back('*');
+
+	if (!params.empty())
+	{
+		for (std::vector<std::string>::const_iterator i = params.begin(); i != params.end()-1; ++i)
+		{
+			out.push_back(' ');
+			out.append(*i);
+		}
+		out.append(" :", 2).append(params.back());
+	}
+
+	// Truncate if too long
+	std::string::size_type maxline = ServerInstance->Config->Limits.MaxLine - 2;
+	if (out.length() > maxline)
+		out.erase(maxline);
+
+	out.append("\r\n", 2);
+	return true;
+}
+
 class ModuleCoreRFCSerializer : public Module
 {
 	RFCSerializer rfcserializer;
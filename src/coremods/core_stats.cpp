@@ -68,6 +68,13 @@ class CommandStats : public Command
 	}
 };
 
+/** The names of the module events in the order they are defined in Implementation. */
+static const char* const EventNames[] = {
+#define INSPIRCD_EVENT_NAME(name) #name,
+	INSPIRCD_MODULE_EVENTS(INSPIRCD_EVENT_NAME)
+#undef INSPIRCD_EVENT_NAME
+};
+
 static void GenerateStatsLl(Stats::Context& stats)
 {
 	stats.AddRow(211, InspIRCd::Format("nick[ident@%s] sendq cmds_out bytes_out cmds_in bytes_in time_open", (stats.GetSymbol() == 'l' ? "host" : "ip")));
@@ -245,6 +252,11 @@ void CommandStats::DoStats(Stats::Context& stats)
 			stats.AddRow(249, InspIRCd::Format("Bandwidth out:    %03.5f kilobits/sec", kbitpersec_out));
 			stats.AddRow(249, InspIRCd::Format("Bandwidth in:     %03.5f kilobits/sec", kbitpersec_in));
 
+			stats.AddRow(249, InspIRCd::Format("SendQ total:      %zu bytes", StreamSocket::SendQueue::GetTotalBytes()));
+			stats.AddRow(249, InspIRCd::Format("SendQ users:      %zu bytes (budget %lu bytes)", StreamSocket::SendQueue::GetUserBytes(), ServerInstance->Config->SendQBudget));
+			stats.AddRow(249, InspIRCd::Format("SendQ throttled:  %lu", ServerInstance->stats.SendQThrottled));
+			stats.AddRow(249, InspIRCd::Format("SendQ evicted:    %lu", ServerInstance->stats.SendQEvicted));
+
 #ifndef _WIN32
 			/* Moved this down here so all the not-windows stuff (look w00tie, I didn't say win32!) is in one ifndef.
 			 * Also cuts out some identical code in both branches of the ifndef. -- Om
@@ -309,9 +321,42 @@ void CommandStats::DoStats(Stats::Context& stats)
 		}
 		break;
 
+		/* stats M (show per-module resource usage) */
+		case 'M':
+		{
+			for (const auto& [modname, mod] : ServerInstance->Modules.GetModules())
+			{
+				const ModuleManager::OwnedResources resources = ServerInstance->Modules.GetOwnedResources(mod);
+				stats.AddRow(249, InspIRCd::Format("%s hooks %lu (%.3f ms) commands %lu (%.3f ms) services %zu extensions %zu (%zu set) timers %zu sockets %zu",
+					modname.c_str(), mod->hookusage.calls, mod->hookusage.time / 1000000.0, mod->commandusage.calls,
+					mod->commandusage.time / 1000000.0, resources.services, resources.extitems, resources.extvalues,
+					resources.timers, resources.sockets));
+			}
+
+			// Timers and sockets which were leaked by an unloaded module can not be attributed to a loaded one.
+			const size_t orphanedtimers = ServerInstance->Timers.GetOrphanedTimers();
+			const size_t orphanedsockets = SocketEngine::GetOrphanedHandlers();
+			if (orphanedtimers || orphanedsockets)
+				stats.AddRow(249, InspIRCd::Format("Orphaned timers %zu sockets %zu", orphanedtimers, orphanedsockets));
+		}
+		break;
+
+		/* stats h (show how many times each module event has been dispatched) */
+		case 'h':
+		{
+			for (size_t event = 0; event < I_END; ++event)
+			{
+				const unsigned long calls = ServerInstance->Modules.EventCalls[event];
+				if (calls)
+					stats.AddRow(249, InspIRCd::Format("%s dispatched %lu times (%zu handlers)", EventNames[event], calls,
+						ServerInstance->Modules.EventHandlers[event].size()));
+			}
+		}
+		break;
+
 		case 'T':
 		{
-			stats.AddRow(249, "accepts "+ConvToStr(ServerInstance->stats.Accept)+" refused "+ConvToStr(ServerInstance->stats.Refused));
+			stats.AddRow(249, "accepts "+ConvToStr(ServerInstance->stats.Accept)+" refused "+ConvToStr(ServerInstance->stats.Refused)+" rejected "+ConvToStr(ServerInstance->stats.Rejected));
 			stats.AddRow(249, "unknown commands "+ConvToStr(ServerInstance->stats.Unknown));
 			stats.AddRow(249, "nick collisions "+ConvToStr(ServerInstance->stats.Collisions));
 			stats.AddRow(249, "dns requests "+ConvToStr(ServerInstance->stats.DnsGood+ServerInstance->stats.DnsBad)+" succeeded "+ConvToStr(ServerInstance->stats.DnsGood)+" failed "+ConvToStr(ServerInstance->stats.DnsBad));
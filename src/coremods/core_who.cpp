@@ -559,6 +559,12 @@ void CommandWho::SendWhoLine(LocalUser* source, const std::vector<std::string>&
 
 CmdResult CommandWho::HandleLocal(LocalUser* user, const Params& parameters)
 {
+	if (ServerInstance->Users.ThrottleOutput(user))
+	{
+		user->WriteNumeric(RPL_TRYAGAIN, name, "Server load is temporarily too heavy. Please wait a while and try again.");
+		return CmdResult::FAILURE;
+	}
+
 	WhoData data(parameters);
 
 	// Is the source running a WHO on a channel?
@@ -41,7 +41,15 @@ DLLManager::DLLManager(const std::string& name)
 		return;
 	}
 
-#ifdef _WIN32
+#if defined PURE_STATIC
+	const StaticModuleMap& modules = GetStaticModules();
+	StaticModuleMap::const_iterator iter = modules.find(name.substr(name.rfind('/') + 1));
+	if (iter != modules.end())
+		lib = iter->second;
+	else
+		err.assign(name + " was not linked into this binary");
+	return;
+#elif defined _WIN32
 	lib = LoadLibraryA(name.c_str());
 #else
 	lib = dlopen(name.c_str(), RTLD_NOW|RTLD_LOCAL);
@@ -56,7 +64,9 @@ DLLManager::~DLLManager()
 	if (!lib)
 		return;
 
-#ifdef _WIN32
+#if defined PURE_STATIC
+	// Nothing to unload.
+#elif defined _WIN32
 	FreeLibrary(lib);
 #else
 	dlclose(lib);
@@ -68,6 +78,9 @@ Module* DLLManager::CallInit()
 	if (!lib)
 		return NULL;
 
+#ifdef PURE_STATIC
+	return lib();
+#else
 	const unsigned long* abi = GetSymbol<const unsigned long>(MODULE_STR_ABI);
 	if (!abi)
 	{
@@ -97,6 +110,7 @@ Module* DLLManager::CallInit()
 	}
 
 	return (*fptr)();
+#endif
 }
 
 void* DLLManager::GetSymbol(const char* name) const
@@ -104,7 +118,10 @@ void* DLLManager::GetSymbol(const char* name) const
 	if (!lib)
 		return NULL;
 
-#if defined _WIN32
+#if defined PURE_STATIC
+	// Statically linked modules do not export any symbols.
+	return NULL;
+#elif defined _WIN32
 	return GetProcAddress(lib, name);
 #else
 	return dlsym(lib, name);
@@ -129,3 +146,19 @@ void DLLManager::RetrieveLastError()
 	while ((p = err.find_last_of("\r\n")) != std::string::npos)
 		err.erase(p, 1);
 }
+
+#ifdef PURE_STATIC
+DLLManager::StaticModuleMap& DLLManager::GetStaticModules()
+{
+	// This is a function local static so that it is initialised before any
+	// of the modules try to register themselves.
+	static StaticModuleMap modules;
+	return modules;
+}
+
+bool DLLManager::RegisterStatic(const char* name, InitFunction init)
+{
+	GetStaticModules()[name] = init;
+	return true;
+}
+#endif
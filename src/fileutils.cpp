@@ -21,6 +21,7 @@
 #include "inspircd.h"
 
 #include <fstream>
+#include <mutex>
 
 #ifndef _WIN32
 # include <dirent.h>
@@ -38,6 +39,77 @@ std::string FilePosition::str() const
 	return name + ":" + ConvToStr(line) + ":" + ConvToStr(column);
 }
 
+namespace
+{
+	/** A file which has been read from disk by FileReader. */
+	struct CachedFile
+	{
+		/** The time at which the file was last modified when it was read. */
+		time_t mtime;
+
+		/** The sub-second part of the modification time when it was read. */
+		long mtimensec;
+
+		/** The inode of the file when it was read. */
+		ino_t inode;
+
+		/** The size of the file when it was read. */
+		off_t size;
+
+		/** The lines of text in the file. */
+		std::shared_ptr<const file_cache> lines;
+
+		/** The size of the file in bytes as reported by FileReader::TotalSize(). */
+		unsigned long totalsize;
+	};
+
+	/** The files which have been read from disk keyed by their path. */
+	std::unordered_map<std::string, CachedFile> filecache;
+
+	/** Protects filecache as files can be read by the config reader thread. */
+	std::mutex filecachemutex;
+
+	/** Retrieves the sub-second part of the modification time of a file. */
+	long GetModifiedNanos(const struct stat& sb)
+	{
+#if defined __APPLE__
+		return sb.st_mtimespec.tv_nsec;
+#elif defined _WIN32
+		return 0;
+#else
+		return sb.st_mtim.tv_nsec;
+#endif
+	}
+
+	/** Reads a file from disk and splits it into lines. */
+	bool ReadFile(const std::string& path, CachedFile& cached)
+	{
+		std::ifstream stream(path, std::ios::binary);
+		if (!stream.is_open())
+			return false;
+
+		std::string buffer;
+		buffer.reserve(cached.size);
+		buffer.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+
+		auto lines = std::make_shared<file_cache>();
+		cached.totalsize = 0;
+		for (size_t start = 0; start < buffer.length(); )
+		{
+			size_t end = buffer.find('\n', start);
+			if (end == std::string::npos)
+				end = buffer.length();
+
+			lines->emplace_back(buffer, start, end - start);
+			cached.totalsize += end - start + 2;
+			start = end + 1;
+		}
+
+		cached.lines = lines;
+		return true;
+	}
+}
+
 FileReader::FileReader(const std::string& filename)
 {
 	Load(filename);
@@ -49,37 +121,71 @@ void FileReader::Load(const std::string& filename)
 	ConfigFileCache::const_iterator it = ServerInstance->Config->Files.find(filename);
 	if (it != ServerInstance->Config->Files.end())
 	{
-		this->lines = it->second;
+		this->lines = std::make_shared<const file_cache>(it->second);
+		this->totalSize = 0;
+		for (const auto& line : it->second)
+			totalSize += line.size() + 2;
 	}
 	else
 	{
-		std::ifstream stream(ServerInstance->Config->Paths.PrependConfig(filename));
-		if (!stream.is_open())
-			throw CoreException(filename + " does not exist or is not readable!");
+		LoadFromDisk(filename);
+	}
+}
+
+void FileReader::LoadFromDisk(const std::string& filename)
+{
+	const std::string path = ServerInstance->Config->Paths.PrependConfig(filename);
+
+	struct stat sb;
+	if (stat(path.c_str(), &sb) == -1 || (sb.st_mode & S_IFDIR))
+	{
+		std::lock_guard<std::mutex> lock(filecachemutex);
+		filecache.erase(path);
+		throw CoreException(filename + " does not exist or is not readable!");
+	}
 
-		lines.clear();
-		std::string line;
-		while (std::getline(stream, line))
+	// Only read the file again if it has been modified or replaced since it was
+	// cached. The sub-second modification time and the inode catch rewrites which
+	// happen within the same second and do not change the size of the file.
+	const long mtimensec = GetModifiedNanos(sb);
+	std::lock_guard<std::mutex> lock(filecachemutex);
+	CachedFile& cached = filecache[path];
+	if (!cached.lines || cached.mtime != sb.st_mtime || cached.mtimensec != mtimensec || cached.inode != sb.st_ino || cached.size != sb.st_size)
+	{
+		cached.mtime = sb.st_mtime;
+		cached.mtimensec = mtimensec;
+		cached.inode = sb.st_ino;
+		cached.size = sb.st_size;
+		if (!ReadFile(path, cached))
 		{
-			lines.push_back(line);
-			totalSize += line.size() + 2;
+			filecache.erase(path);
+			throw CoreException(filename + " does not exist or is not readable!");
 		}
-
-		stream.close();
+		ServerInstance->Logs.Log("CONFIG", LOG_DEBUG, "Read %s into the file cache (%zu lines)", path.c_str(), cached.lines->size());
 	}
+
+	this->lines = cached.lines;
+	this->totalSize = cached.totalsize;
 }
 
 std::string FileReader::GetString() const
 {
 	std::string buffer;
-	for (file_cache::const_iterator it = this->lines.begin(); it != this->lines.end(); ++it)
+	buffer.reserve(totalSize);
+	for (const auto& line : GetVector())
 	{
-		buffer.append(*it);
+		buffer.append(line);
 		buffer.append("\r\n");
 	}
 	return buffer;
 }
 
+const std::vector<std::string>& FileReader::GetVector() const
+{
+	static const file_cache empty;
+	return lines ? *lines : empty;
+}
+
 std::string FileSystem::ExpandPath(const std::string& base, const std::string& fragment)
 {
 	// The fragment is an absolute path, don't modify it.
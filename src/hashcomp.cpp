@@ -151,14 +151,19 @@ bool irc::insensitive_swo::operator()(const std::string& a, const std::string& b
 size_t irc::insensitive::operator()(const std::string &s) const
 {
 	/* XXX: NO DATA COPIES! :)
-	 * The hash function here is practically
-	 * a copy of the one in STL's hash_fun.h,
-	 * only with *x replaced with national_case_insensitive_map[*x].
-	 * This avoids a copy to use hash<const char*>
+	 * The hash function here is FNV-1a, only with *x
+	 * replaced with national_case_insensitive_map[*x].
+	 * This avoids a copy to use std::hash<std::string>
+	 * and spreads keys which only differ in their last
+	 * few characters (e.g. UUIDs) over the whole table.
 	 */
-	size_t t = 0;
+	static constexpr bool is64bit = sizeof(size_t) == 8;
+	static constexpr size_t offsetbasis = is64bit ? static_cast<size_t>(14695981039346656037ULL) : static_cast<size_t>(2166136261UL);
+	static constexpr size_t prime = is64bit ? static_cast<size_t>(1099511628211ULL) : static_cast<size_t>(16777619UL);
+
+	size_t t = offsetbasis;
 	for (std::string::const_iterator x = s.begin(); x != s.end(); ++x) /* ++x not x++, as its faster */
-		t = 5 * t + national_case_insensitive_map[(unsigned char)*x];
+		t = (t ^ national_case_insensitive_map[(unsigned char)*x]) * prime;
 	return t;
 }
 
@@ -428,7 +428,8 @@ std::string InspIRCd::DurationString(time_t duration)
 
 std::string InspIRCd::Format(va_list& vaList, const char* formatString)
 {
-	static std::vector<char> formatBuffer(1024);
+	// This is thread local as it is used by messages which are logged on startup task threads.
+	static thread_local std::vector<char> formatBuffer(1024);
 
 	while (true)
 	{
@@ -84,6 +84,28 @@ namespace
 {
 	void VoidSignalHandler(int);
 
+	// Runs a housekeeping task from the main loop every few seconds.
+	class HousekeepingTimer final : public Timer
+	{
+	 private:
+		// The task to run when the timer ticks.
+		std::function<void(time_t)> task;
+
+	 public:
+		HousekeepingTimer(unsigned int secs, std::function<void(time_t)> func)
+			: Timer(secs, true)
+			, task(func)
+		{
+			ServerInstance->Timers.AddTimer(this);
+		}
+
+		bool Tick(time_t currtime) override
+		{
+			task(currtime);
+			return true;
+		}
+	};
+
 	// Warns a user running as root that they probably shouldn't.
 	void CheckRoot()
 	{
@@ -543,8 +565,8 @@ InspIRCd::InspIRCd(int argc, char** argv)
 	/* During startup we read the configuration now, not in
 	 * a separate thread
 	 */
-	this->Config->Read();
-	this->Config->Apply(NULL, "");
+	Startup.TimePhase("reading the config", [this] { this->Config->Read(); });
+	Startup.TimePhase("applying the config", [this] { this->Config->Apply(NULL, ""); });
 	Logs.OpenFileLogs();
 
 	// If we don't have a SID, generate one based on the server name and the server description
@@ -562,9 +584,10 @@ InspIRCd::InspIRCd(int argc, char** argv)
 
 	std::cout << std::endl;
 
-	TryBindPorts();
+	Startup.TimePhase("binding ports", [] { TryBindPorts(); });
 
 	this->Modules.LoadAll();
+	Startup.Report();
 
 	std::cout << "InspIRCd is now running as '" << Config->ServerName << "'[" << Config->GetSID() << "] with " << SocketEngine::GetMaxFds() << " max open sockets" << std::endl;
 
@@ -627,6 +650,41 @@ InspIRCd::InspIRCd(int argc, char** argv)
 	Logs.Log("STARTUP", LOG_DEFAULT, "Startup complete as '%s'[%s], %lu max open sockets", Config->ServerName.c_str(),Config->GetSID().c_str(), SocketEngine::GetMaxFds());
 }
 
+void StartupProfile::Report()
+{
+	const auto milliseconds = [](Clock::duration time)
+	{
+		return std::chrono::duration<double, std::milli>(time).count();
+	};
+
+	std::string summary = InspIRCd::Format("Startup took %.1fms", milliseconds(Clock::now() - started));
+	for (const auto& phase : phases)
+		summary.append(InspIRCd::Format("%s %s %.1fms", &phase == &phases.front() ? ":" : ",", phase.name.c_str(), milliseconds(phase.time)));
+	ServerInstance->Logs.Log("STARTUP", LOG_DEFAULT, summary);
+	std::cout << summary << std::endl;
+
+	for (const auto& step : steps)
+		ServerInstance->Logs.Log("STARTUP", LOG_DEBUG, "%s took %.1fms", step.name.c_str(), milliseconds(step.time));
+
+	// When looking for what slowed down the startup only the slowest steps are interesting.
+	const size_t slowcount = std::min<size_t>(steps.size(), 5);
+	std::partial_sort(steps.begin(), steps.begin() + slowcount, steps.end(), [](const Step& lhs, const Step& rhs) {
+		return lhs.time > rhs.time;
+	});
+
+	if (slowcount)
+	{
+		std::string slowest = "Slowest startup steps";
+		for (size_t idx = 0; idx < slowcount; ++idx)
+			slowest.append(InspIRCd::Format("%s %s %.1fms", idx ? "," : ":", steps[idx].name.c_str(), milliseconds(steps[idx].time)));
+		ServerInstance->Logs.Log("STARTUP", LOG_DEFAULT, slowest);
+		std::cout << slowest << std::endl << std::endl;
+	}
+
+	std::vector<Step>().swap(phases);
+	std::vector<Step>().swap(steps);
+}
+
 void InspIRCd::UpdateTime()
 {
 #if defined HAS_CLOCK_GETTIME
@@ -636,7 +694,7 @@ void InspIRCd::UpdateTime()
 	GetSystemTime(&st);
 
 	TIME.tv_sec = time(NULL);
-	TIME.tv_nsec = st.wMilliseconds;
+	TIME.tv_nsec = st.wMilliseconds * 1000000;
 #else
 	struct timeval tv;
 	gettimeofday(&tv, NULL);
@@ -649,7 +707,30 @@ void InspIRCd::UpdateTime()
 void InspIRCd::Run()
 {
 	UpdateTime();
-	time_t OLDTIME = TIME.tv_sec;
+
+	// The socket engine only wakes up when a timer is due so the periodic
+	// housekeeping is run from timers rather than on every iteration.
+	time_t lasttick = TIME.tv_sec;
+	HousekeepingTimer statstimer(1, [&lasttick](time_t currtime) {
+		CollectStats();
+		CheckTimeSkip(lasttick, currtime);
+		lasttick = currtime;
+		ServerInstance->Users.DoBackgroundUserStuff();
+	});
+
+	/* Run background module timers every few seconds
+	 * (the docs say modules should not rely on accurate
+	 * timing using this event, so we dont have to
+	 * time this exactly).
+	 */
+	HousekeepingTimer backgroundtimer(5, [](time_t currtime) {
+		FOREACH_MOD(OnBackgroundTimer, (currtime));
+		ServerInstance->SNO.FlushSnotices();
+	});
+
+	HousekeepingTimer gctimer(3600, [](time_t) {
+		FOREACH_MOD(OnGarbageCollect, ());
+	});
 
 	while (true)
 	{
@@ -663,31 +744,7 @@ void InspIRCd::Run()
 		}
 
 		UpdateTime();
-
-		/* Run background module timers every few seconds
-		 * (the docs say modules should not rely on accurate
-		 * timing using this event, so we dont have to
-		 * time this exactly).
-		 */
-		if (TIME.tv_sec != OLDTIME)
-		{
-			CollectStats();
-			CheckTimeSkip(OLDTIME, TIME.tv_sec);
-
-			OLDTIME = TIME.tv_sec;
-
-			if ((TIME.tv_sec % 3600) == 0)
-				FOREACH_MOD(OnGarbageCollect, ());
-
-			Timers.TickTimers(TIME.tv_sec);
-			Users.DoBackgroundUserStuff();
-
-			if ((TIME.tv_sec % 5) == 0)
-			{
-				FOREACH_MOD(OnBackgroundTimer, (TIME.tv_sec));
-				SNO.FlushSnotices();
-			}
-		}
+		Timers.TickTimers(Time_ms());
 
 		/* Call the socket engine to wait on the active
 		 * file descriptors. The socket engine has everything's
@@ -31,6 +31,9 @@
 #include "inspircd.h"
 #include "iohook.h"
 
+size_t StreamSocket::SendQueue::totalbytes = 0;
+size_t StreamSocket::SendQueue::userbytes = 0;
+
 static IOHook* GetNextHook(IOHook* hook)
 {
 	IOHookMiddle* const iohm = IOHookMiddle::ToMiddleHook(hook);
@@ -39,13 +42,15 @@ static IOHook* GetNextHook(IOHook* hook)
 	return NULL;
 }
 
-BufferedSocket::BufferedSocket()
+BufferedSocket::BufferedSocket(Module* mod)
+	: StreamSocket(SS_UNKNOWN, mod)
 {
 	Timeout = NULL;
 	state = I_ERROR;
 }
 
-BufferedSocket::BufferedSocket(int newfd)
+BufferedSocket::BufferedSocket(int newfd, Module* mod)
+	: StreamSocket(SS_UNKNOWN, mod)
 {
 	Timeout = NULL;
 	this->fd = newfd;
@@ -368,6 +373,13 @@ void StreamSocket::WriteData(const std::string &data)
 	SocketEngine::ChangeEventMask(this, FD_ADD_TRIAL_WRITE);
 }
 
+SocketTimeout::SocketTimeout(int fd, BufferedSocket* thesock, unsigned int secs_from_now)
+	: Timer(secs_from_now, false, thesock->owner)
+	, sock(thesock)
+	, sfd(fd)
+{
+}
+
 bool SocketTimeout::Tick(time_t)
 {
 	ServerInstance->Logs.Log("SOCKET", LOG_DEBUG, "SocketTimeout::Tick");
@@ -556,5 +568,5 @@ void StreamSocket::SwapInternals(StreamSocket& other)
 	std::swap(error, other.error);
 	std::swap(iohook, other.iohook);
 	std::swap(recvq, other.recvq);
-	std::swap(sendq, other.sendq);
+	sendq.swap(other.sendq);
 }
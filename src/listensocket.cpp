@@ -210,6 +210,26 @@ void ListenSocket::OnEventHandlerRead()
 		const std::string type = bind_tag->getString("type", "clients", 1);
 		if (stdalgo::string::equalsci(type, "clients"))
 		{
+			std::string reason;
+			if (ServerInstance->Users.IsBannedConnection(client, reason))
+			{
+				// Reject the connection before we spend any time setting up a user
+				// for it. This is a best effort so we don't care if the send fails.
+				// If the listener has an I/O hook (e.g. TLS) then the client is not
+				// expecting plaintext so we just close the socket.
+				ServerInstance->stats.Rejected++;
+				if (!HasIOHooks())
+				{
+					std::string message;
+					if (!ServerInstance->Config->XLineMessage.empty())
+						message.append(InspIRCd::Format(":%s %03d * :%s\r\n", ServerInstance->Config->GetServerName().c_str(), ERR_YOUREBANNEDCREEP, ServerInstance->Config->XLineMessage.c_str()));
+					message.append(InspIRCd::Format("ERROR :Closing link: (unknown@%s) [%s]\r\n", client.addr().c_str(), reason.c_str()));
+					send(incomingSockfd, message.data(), message.length(), 0);
+				}
+				SocketEngine::Close(incomingSockfd);
+				return;
+			}
+
 			ServerInstance->Users.AddUser(incomingSockfd, this, &client, &server);
 			res = MOD_RES_ALLOW;
 		}
@@ -227,6 +247,16 @@ void ListenSocket::OnEventHandlerRead()
 	}
 }
 
+bool ListenSocket::HasIOHooks() const
+{
+	for (IOHookProvList::const_iterator i = iohookprovs.begin(); i != iohookprovs.end(); ++i)
+	{
+		if (!i->GetProvider().empty())
+			return true;
+	}
+	return false;
+}
+
 void ListenSocket::ResetIOHookProvider()
 {
 	iohookprovs[0].SetProvider(bind_tag->getString("hook"));
@@ -22,6 +22,10 @@
 #include "inspircd.h"
 #include "listmode.h"
 
+// The serial that will be given to the next list which is modified. This is
+// shared by all lists so that a recreated list never reuses an old serial.
+static unsigned long nextserial = 0;
+
 ListModeBase::ListModeBase(Module* Creator, const std::string& Name, char modechar, const std::string& eolstr, unsigned int lnum, unsigned int eolnum, bool autotidy)
 	: ModeHandler(Creator, Name, modechar, PARAM_ALWAYS, MODETYPE_CHANNEL, MC_LIST)
 	, listnumeric(lnum)
@@ -203,6 +207,7 @@ ModeAction ListModeBase::OnModeChange(User* source, User*, Channel* channel, std
 		{
 			// And now add the mask onto the list...
 			cd->list.push_back(ListItem(parameter, source->nick, ServerInstance->Time()));
+			cd->serial = ++nextserial;
 			return MODEACTION_ALLOW;
 		}
 		else
@@ -221,6 +226,7 @@ ModeAction ListModeBase::OnModeChange(User* source, User*, Channel* channel, std
 				if (parameter == it->mask)
 				{
 					stdalgo::vector::swaperase(cd->list, it);
+					cd->serial = ++nextserial;
 					return MODEACTION_ALLOW;
 				}
 			}
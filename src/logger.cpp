@@ -262,9 +262,20 @@ bool LogManager::DelLogType(const std::string &type, LogStream *l)
 	return true;
 }
 
+namespace
+{
+	// If non-null then the list that messages logged on this thread are captured into.
+	thread_local std::vector<LogManager::CapturedMessage>* capturedmessages = nullptr;
+}
+
+void LogManager::CaptureThread(std::vector<CapturedMessage>* messages)
+{
+	capturedmessages = messages;
+}
+
 void LogManager::Log(const std::string &type, LogLevel loglevel, const char *fmt, ...)
 {
-	if (Logging)
+	if (!capturedmessages && Logging)
 		return;
 
 	std::string buf;
@@ -274,6 +285,12 @@ void LogManager::Log(const std::string &type, LogLevel loglevel, const char *fmt
 
 void LogManager::Log(const std::string &type, LogLevel loglevel, const std::string &msg)
 {
+	if (capturedmessages)
+	{
+		capturedmessages->push_back({ type, loglevel, msg });
+		return;
+	}
+
 	if (Logging)
 	{
 		return;
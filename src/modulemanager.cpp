@@ -40,7 +40,11 @@ bool ModuleManager::Load(const std::string& modname, bool defer)
 	const std::string filename = ExpandModName(modname);
 	const std::string moduleFile = ServerInstance->Config->Paths.PrependModule(filename);
 
+#ifdef PURE_STATIC
+	if (!DLLManager::GetStaticModules().count(filename))
+#else
 	if (!FileSystem::FileExists(moduleFile))
+#endif
 	{
 		LastModuleError = "Module file could not be found: " + filename;
 		ServerInstance->Logs.Log("MODULE", LOG_DEFAULT, LastModuleError);
@@ -127,24 +131,36 @@ void ModuleManager::LoadCoreModules(std::map<std::string, ServiceList>& servicem
 {
 	std::cout << "Loading core modules " << std::flush;
 
+	auto loadcore = [this, &servicemap](const std::string& name)
+	{
+		if (!InspIRCd::Match(name, "core_*" DLL_EXTENSION))
+			return;
+
+		std::cout << "." << std::flush;
+		this->NewServices = &servicemap[name];
+
+		const auto loadstart = StartupProfile::Clock::now();
+		if (!Load(name, true))
+		{
+			ServerInstance->Logs.Log("MODULE", LOG_DEFAULT, this->LastError());
+			std::cout << std::endl << "[" << con_red << "*" << con_reset << "] " << this->LastError() << std::endl << std::endl;
+			ServerInstance->Exit(EXIT_STATUS_MODULE);
+		}
+		ServerInstance->Startup.AddStep(name + " load", StartupProfile::Clock::now() - loadstart);
+	};
+
 	try
 	{
+#ifdef PURE_STATIC
+		for (const auto& [name, _] : DLLManager::GetStaticModules())
+			loadcore(name);
+#else
 		for (auto& entry : std::filesystem::directory_iterator(ServerInstance->Config->Paths.Module))
 		{
-			const std::string name = entry.path().filename();
-			if (!entry.is_regular_file() || !InspIRCd::Match(name, "core_*" DLL_EXTENSION))
-				continue;
-
-			std::cout << "." << std::flush;
-			this->NewServices = &servicemap[name];
-
-			if (!Load(name, true))
-			{
-				ServerInstance->Logs.Log("MODULE", LOG_DEFAULT, this->LastError());
-				std::cout << std::endl << "[" << con_red << "*" << con_reset << "] " << this->LastError() << std::endl << std::endl;
-				ServerInstance->Exit(EXIT_STATUS_MODULE);
-			}
+			if (entry.is_regular_file())
+				loadcore(entry.path().filename());
 		}
+#endif
 	}
 	catch (const std::filesystem::filesystem_error& err)
 	{
@@ -45,12 +45,33 @@ void dynamic_reference_base::reset_all()
 		(*i)->resolve();
 }
 
+bool Module::UsageTimer::enabled = false;
+
+namespace
+{
+	unsigned long nextmoduleserial = 0;
+}
+
 Module::Module(int mprops, const std::string& mdesc)
 	: description(mdesc)
 	, properties(mprops)
+	, serial(++nextmoduleserial)
 {
 }
 
+Module::~Module()
+{
+	// Anything which is still counted against this module now has an owner
+	// which no longer exists so move it out of the per-module counts.
+	const size_t timers = ServerInstance->Timers.OrphanTimers(this);
+	const size_t sockets = SocketEngine::OrphanHandlers(this);
+	if (timers || sockets)
+	{
+		ServerInstance->Logs.Log("MODULE", LOG_DEBUG, "%s was destroyed with %zu timers and %zu sockets still open",
+			ModuleSourceFile.c_str(), timers, sockets);
+	}
+}
+
 // These declarations define the behavours of the base class Module (which does nothing at all)
 CullResult Module::cull()
 {
@@ -482,9 +503,136 @@ bool ModuleManager::Unload(Module* mod)
 	return true;
 }
 
+namespace
+{
+	/** A worker thread which runs startup tasks. */
+	class StartupWorker final : public Thread
+	{
+	 private:
+		/** The function which runs the startup tasks. */
+		std::function<void()> runtasks;
+
+	 protected:
+		/** @copydoc Thread::OnStart */
+		void OnStart() override
+		{
+			runtasks();
+		}
+
+	 public:
+		StartupWorker(const std::function<void()>& func)
+			: runtasks(func)
+		{
+		}
+	};
+}
+
+void ModuleManager::AddStartupTask(Module* mod, const std::string& name, std::function<void()> work, std::function<void()> done)
+{
+	if (!DeferStartupTasks)
+	{
+		if (work)
+			work();
+		if (done)
+			done();
+		return;
+	}
+
+	StartupTasks.push_back({ mod, name, std::move(work), std::move(done), { }, nullptr, { } });
+}
+
+void ModuleManager::RunStartupTasks(const std::string& phase, const std::string& action, int exitcode)
+{
+	const auto phasestart = StartupProfile::Clock::now();
+
+	// Tasks may add more tasks when they complete so keep going until there are none left.
+	while (!StartupTasks.empty())
+	{
+		std::vector<StartupTask> tasks;
+		tasks.swap(StartupTasks);
+
+		std::atomic<size_t> nexttask(0);
+		auto runtasks = [&tasks, &nexttask]
+		{
+			for (size_t idx; (idx = nexttask++) < tasks.size(); )
+			{
+				StartupTask& task = tasks[idx];
+				if (!task.work)
+					continue;
+
+				LogManager::CaptureThread(&task.messages);
+				const auto started = std::chrono::steady_clock::now();
+				try
+				{
+					task.work();
+				}
+				catch (...)
+				{
+					task.error = std::current_exception();
+				}
+				task.time = std::chrono::steady_clock::now() - started;
+				LogManager::CaptureThread(nullptr);
+			}
+		};
+
+		// The main thread runs tasks too so only start threads for the remainder.
+		size_t threads = ServerInstance->Config->StartupThreads;
+		if (!threads)
+			threads = std::max(std::thread::hardware_concurrency(), 1U);
+		std::vector<std::unique_ptr<StartupWorker>> workers;
+		while (workers.size() + 1 < std::min(threads, tasks.size()))
+		{
+			workers.push_back(std::make_unique<StartupWorker>(runtasks));
+			workers.back()->Start();
+		}
+		runtasks();
+		for (const auto& worker : workers)
+			worker->Stop();
+
+		// Results are applied in the order that the tasks were added.
+		for (auto& task : tasks)
+		{
+			for (const auto& message : task.messages)
+				ServerInstance->Logs.Log(message.type, message.level, message.message);
+
+			try
+			{
+				if (task.error)
+					std::rethrow_exception(task.error);
+
+				if (task.done)
+				{
+					const auto started = std::chrono::steady_clock::now();
+					task.done();
+					task.time += std::chrono::steady_clock::now() - started;
+				}
+
+				ServerInstance->Startup.AddStep(task.creator->ModuleSourceFile + " " + task.name, task.time);
+				continue;
+			}
+			catch (const CoreException& modexcept)
+			{
+				LastModuleError = "Unable to " + action + " " + task.creator->ModuleSourceFile + ": " + modexcept.GetReason();
+			}
+			catch (const std::exception& stdexcept)
+			{
+				LastModuleError = "Unable to " + action + " " + task.creator->ModuleSourceFile + ": " + stdexcept.what();
+			}
+
+			ServerInstance->Logs.Log("MODULE", LOG_DEFAULT, LastModuleError);
+			std::cout << std::endl << "[" << con_red << "*" << con_reset << "] " << LastModuleError << std::endl << std::endl;
+			ServerInstance->Exit(exitcode);
+		}
+	}
+
+	ServerInstance->Startup.AddPhase(phase, StartupProfile::Clock::now() - phasestart);
+}
+
 void ModuleManager::LoadAll()
 {
 	std::map<std::string, ServiceList> servicemap;
+	DeferStartupTasks = true;
+	auto phasestart = StartupProfile::Clock::now();
 	LoadCoreModules(servicemap);
 
 	// Step 1: load all of the modules.
@@ -501,15 +649,19 @@ void ModuleManager::LoadAll()
 
 		this->NewServices = &servicemap[name];
 		std::cout << "[" << con_green << "*" << con_reset << "] Loading module:\t" << con_green << name << con_reset << std::endl;
+		const auto loadstart = StartupProfile::Clock::now();
 		if (!this->Load(name, true))
 		{
 			ServerInstance->Logs.Log("MODULE", LOG_DEFAULT, this->LastError());
 			std::cout << std::endl << "[" << con_red << "*" << con_reset << "] " << this->LastError() << std::endl << std::endl;
 			ServerInstance->Exit(EXIT_STATUS_MODULE);
 		}
+		ServerInstance->Startup.AddStep(name + " load", StartupProfile::Clock::now() - loadstart);
 	}
+	ServerInstance->Startup.AddPhase("loading modules", StartupProfile::Clock::now() - phasestart);
 
 	// Step 2: initialize the modules and register their services.
+	phasestart = StartupProfile::Clock::now();
 	for (ModuleMap::const_iterator i = Modules.begin(); i != Modules.end(); ++i)
 	{
 		Module* mod = i->second;
@@ -518,7 +670,7 @@ void ModuleManager::LoadAll()
 			ServerInstance->Logs.Log("MODULE", LOG_DEBUG, "Initializing %s", i->first.c_str());
 			AttachAll(mod);
 			AddServices(servicemap[i->first]);
-			mod->init();
+			ServerInstance->Startup.TimeStep(i->first + " init()", [mod] { mod->init(); });
 		}
 		catch (CoreException& modexcept)
 		{
@@ -528,20 +680,23 @@ void ModuleManager::LoadAll()
 			ServerInstance->Exit(EXIT_STATUS_MODULE);
 		}
 	}
+	ServerInstance->Startup.AddPhase("initializing modules", StartupProfile::Clock::now() - phasestart);
 
 	this->NewServices = NULL;
+	RunStartupTasks("running initialization tasks", "initialize", EXIT_STATUS_MODULE);
 	ConfigStatus confstatus(NULL, true);
 
 	// Step 3: Read the configuration for the modules. This must be done as part of
 	// its own step so that services provided by modules can be registered before
 	// the configuration is read.
+	phasestart = StartupProfile::Clock::now();
 	for (ModuleMap::const_iterator i = Modules.begin(); i != Modules.end(); ++i)
 	{
 		Module* mod = i->second;
 		try
 		{
 			ServerInstance->Logs.Log("MODULE", LOG_DEBUG, "Reading configuration for %s", i->first.c_str());
-			mod->ReadConfig(confstatus);
+			ServerInstance->Startup.TimeStep(i->first + " ReadConfig()", [mod, &confstatus] { mod->ReadConfig(confstatus); });
 		}
 		catch (CoreException& modexcept)
 		{
@@ -551,6 +706,10 @@ void ModuleManager::LoadAll()
 			ServerInstance->Exit(EXIT_STATUS_CONFIG);
 		}
 	}
+	ServerInstance->Startup.AddPhase("configuring modules", StartupProfile::Clock::now() - phasestart);
+
+	RunStartupTasks("running configuration tasks", "read the configuration for", EXIT_STATUS_CONFIG);
+	DeferStartupTasks = false;
 
 	if (!PrioritizeHooks())
 		ServerInstance->Exit(EXIT_STATUS_MODULE);
@@ -728,3 +887,43 @@ void ModuleManager::DelReferent(ServiceProvider* service)
 	}
 	dynamic_reference_base::reset_all();
 }
+
+ModuleManager::OwnedResources ModuleManager::GetOwnedResources(const Module* mod) const
+{
+	OwnedResources resources;
+	for (const auto& [_, cmd] : ServerInstance->Parser.GetCommands())
+	{
+		if (cmd->creator == mod)
+			resources.services++;
+	}
+
+	for (ModeType mt : { MODETYPE_USER, MODETYPE_CHANNEL })
+	{
+		for (const auto& [_, mh] : ServerInstance->Modes.GetModes(mt))
+		{
+			if (mh->creator == mod)
+				resources.services++;
+		}
+	}
+
+	for (const auto& [name, service] : DataProviders)
+	{
+		// Data providers are also stored under aliases so only count them once.
+		if (service->creator == mod && name == service->name)
+			resources.services++;
+	}
+
+	for (const auto& [_, item] : ServerInstance->Extensions.GetExts())
+	{
+		if (item->creator != mod)
+			continue;
+
+		resources.services++;
+		resources.extitems++;
+		resources.extvalues += item->count;
+	}
+
+	resources.timers = ServerInstance->Timers.GetOwnedTimers(mod);
+	resources.sockets = SocketEngine::GetOwnedHandlers(mod);
+	return resources;
+}
@@ -31,7 +31,7 @@
 
 #include <argon2.h>
 
-class ProviderConfig
+class Argon2ProviderConfig
 {
  private:
 	static Argon2_version SanitizeArgon2Version(unsigned long version)
@@ -61,12 +61,12 @@ class ProviderConfig
 	uint32_t threads;
 	Argon2_version version;
 
-	ProviderConfig()
+	Argon2ProviderConfig()
 	{
 		// Nothing interesting happens here.
 	}
 
-	ProviderConfig(const std::string& tagname, ProviderConfig* def)
+	Argon2ProviderConfig(const std::string& tagname, Argon2ProviderConfig* def)
 	{
 		auto tag = ServerInstance->Config->ConfValue(tagname);
 
@@ -99,7 +99,7 @@ class HashArgon2 : public HashProvider
 	const Argon2_type argon2Type;
 
  public:
-	ProviderConfig config;
+	Argon2ProviderConfig config;
 
 	bool Compare(const std::string& input, const std::string& hash) override
 	{
@@ -184,10 +184,10 @@ class ModuleArgon2 : public Module
 
 	void ReadConfig(ConfigStatus& status) override
 	{
-		ProviderConfig defaultConfig("argon2", NULL);
-		argon2i.config = ProviderConfig("argon2i", &defaultConfig);
-		argon2d.config = ProviderConfig("argon2d", &defaultConfig);
-		argon2id.config = ProviderConfig("argon2id", &defaultConfig);
+		Argon2ProviderConfig defaultConfig("argon2", NULL);
+		argon2i.config = Argon2ProviderConfig("argon2i", &defaultConfig);
+		argon2d.config = Argon2ProviderConfig("argon2d", &defaultConfig);
+		argon2id.config = Argon2ProviderConfig("argon2id", &defaultConfig);
 	}
 };
 
@@ -160,18 +160,22 @@ class ModuleGeoMaxMind : public Module
 		auto tag = ServerInstance->Config->ConfValue("maxmind");
 		const std::string file = ServerInstance->Config->Paths.PrependConfig(tag->getString("file", "GeoLite2-Country.mmdb", 1));
 
-		// Try to read the new database.
-		MMDB_s mmdb;
-		int result = MMDB_open(file.c_str(), MMDB_MODE_MMAP, &mmdb);
-		if (result != MMDB_SUCCESS)
-			throw ModuleException(InspIRCd::Format("Unable to load the MaxMind database (%s): %s",
-				file.c_str(), MMDB_strerror(result)));
-
-		// Swap the new database with the old database.
-		std::swap(mmdb, geoapi.mmdb);
-
-		// Free the old database.
-		MMDB_close(&mmdb);
+		// Opening a large database can be slow so the new database is read
+		// as a startup task and swapped in once it has been read.
+		auto mmdb = std::make_shared<MMDB_s>();
+		ServerInstance->Modules.AddStartupTask(this, "reading " + file, [file, mmdb] {
+			// Try to read the new database.
+			int result = MMDB_open(file.c_str(), MMDB_MODE_MMAP, mmdb.get());
+			if (result != MMDB_SUCCESS)
+				throw ModuleException(InspIRCd::Format("Unable to load the MaxMind database (%s): %s",
+					file.c_str(), MMDB_strerror(result)));
+		}, [this, mmdb] {
+			// Swap the new database with the old database.
+			std::swap(*mmdb, geoapi.mmdb);
+
+			// Free the old database.
+			MMDB_close(mmdb.get());
+		});
 	}
 
 	void OnGarbageCollect() override
@@ -42,7 +42,7 @@
 #include <libpq-fe.h>
 #include "modules/sql.h"
 
-/* SQLConn rewritten by peavey to
+/* PgSQLConn rewritten by peavey to
  * use EventHandler instead of
  * BufferedSocket. This is much neater
  * and gives total control of destroy
@@ -50,10 +50,10 @@
  */
 
 /* Forward declare, so we can have the typedef neatly at the top */
-class SQLConn;
+class PgSQLConn;
 class ModulePgSQL;
 
-typedef insp::flat_map<std::string, SQLConn*> ConnMap;
+typedef insp::flat_map<std::string, PgSQLConn*> ConnMap;
 
 enum SQLstatus
 {
@@ -78,9 +78,7 @@ class ReconnectTimer : public Timer
  private:
 	ModulePgSQL* mod;
  public:
-	ReconnectTimer(ModulePgSQL* m) : Timer(5, false), mod(m)
-	{
-	}
+	ReconnectTimer(ModulePgSQL* m);
 	bool Tick(time_t TIME) override;
 };
 
@@ -180,9 +178,9 @@ class PgSQLresult : public SQL::Result
 	}
 };
 
-/** SQLConn represents one SQL session.
+/** PgSQLConn represents one SQL session.
  */
-class SQLConn : public SQL::Provider, public EventHandler
+class PgSQLConn : public SQL::Provider, public EventHandler
 {
  public:
 	std::shared_ptr<ConfigTag> conf;	/* The <database> entry */
@@ -191,8 +189,9 @@ class SQLConn : public SQL::Provider, public EventHandler
 	SQLstatus		status = CWRITE; /* PgSQL database connection status */
 	QueueItem		qinprog;	/* If there is currently a query in progress */
 
-	SQLConn(Module* Creator, std::shared_ptr<ConfigTag> tag)
+	PgSQLConn(Module* Creator, std::shared_ptr<ConfigTag> tag)
 		: SQL::Provider(Creator, tag->getString("id"))
+		, EventHandler(Creator)
 		, conf(tag)
 		, qinprog(NULL, "")
 	{
@@ -207,7 +206,7 @@ class SQLConn : public SQL::Provider, public EventHandler
 		return this->EventHandler::cull();
 	}
 
-	~SQLConn()
+	~PgSQLConn()
 	{
 		SQL::Error err(SQL::BAD_DBID);
 		if (qinprog.c)
@@ -556,7 +555,7 @@ class ModulePgSQL : public Module
 			ConnMap::iterator curr = connections.find(id);
 			if (curr == connections.end())
 			{
-				SQLConn* conn = new SQLConn(this, tag);
+				PgSQLConn* conn = new PgSQLConn(this, tag);
 				if (conn->status != DEAD)
 				{
 					conns.insert(std::make_pair(id, conn));
@@ -590,7 +589,7 @@ class ModulePgSQL : public Module
 		SQL::Error err(SQL::BAD_DBID);
 		for(ConnMap::iterator i = connections.begin(); i != connections.end(); i++)
 		{
-			SQLConn* conn = i->second;
+			PgSQLConn* conn = i->second;
 			if (conn->qinprog.c && conn->qinprog.c->creator == mod)
 			{
 				conn->qinprog.c->OnError(err);
@@ -614,6 +613,12 @@ class ModulePgSQL : public Module
 	}
 };
 
+ReconnectTimer::ReconnectTimer(ModulePgSQL* m)
+	: Timer(5, false, m)
+	, mod(m)
+{
+}
+
 bool ReconnectTimer::Tick(time_t time)
 {
 	mod->retimer = NULL;
@@ -622,7 +627,7 @@ bool ReconnectTimer::Tick(time_t time)
 	return false;
 }
 
-void SQLConn::DelayReconnect()
+void PgSQLConn::DelayReconnect()
 {
 	status = DEAD;
 	ModulePgSQL* mod = (ModulePgSQL*)(Module*)creator;
@@ -43,8 +43,8 @@
 # pragma comment(lib, "sqlite3.lib")
 #endif
 
-class SQLConn;
-typedef insp::flat_map<std::string, SQLConn*> ConnMap;
+class SQLite3Conn;
+typedef insp::flat_map<std::string, SQLite3Conn*> ConnMap;
 
 class SQLite3Result : public SQL::Result
 {
@@ -93,13 +93,13 @@ class SQLite3Result : public SQL::Result
 	}
 };
 
-class SQLConn : public SQL::Provider
+class SQLite3Conn : public SQL::Provider
 {
 	sqlite3* conn;
 	std::shared_ptr<ConfigTag> config;
 
  public:
-	SQLConn(Module* Parent, std::shared_ptr<ConfigTag> tag)
+	SQLite3Conn(Module* Parent, std::shared_ptr<ConfigTag> tag)
 		: SQL::Provider(Parent, tag->getString("id"))
 		, config(tag)
 	{
@@ -113,7 +113,7 @@ class SQLConn : public SQL::Provider
 		}
 	}
 
-	~SQLConn()
+	~SQLite3Conn()
 	{
 		if (conn)
 		{
@@ -246,7 +246,7 @@ class ModuleSQLite3 : public Module
 	{
 		for(ConnMap::iterator i = conns.begin(); i != conns.end(); i++)
 		{
-			SQLConn* conn = i->second;
+			SQLite3Conn* conn = i->second;
 			ServerInstance->Modules.DelService(*conn);
 			delete conn;
 		}
@@ -262,7 +262,7 @@ class ModuleSQLite3 : public Module
 			if (!stdalgo::string::equalsci(tag->getString("module"), "sqlite"))
 				continue;
 
-			SQLConn* conn = new SQLConn(this, tag);
+			SQLite3Conn* conn = new SQLite3Conn(this, tag);
 			conns.insert(std::make_pair(tag->getString("id"), conn));
 			ServerInstance->Modules.AddService(*conn);
 		}
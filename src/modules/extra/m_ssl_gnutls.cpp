@@ -1076,12 +1076,12 @@ int GnuTLS::X509Credentials::cert_callback(gnutls_session_t sess, const gnutls_d
 
 class GnuTLSIOHookProvider : public IOHookProvider
 {
-	GnuTLS::Profile profile;
+	std::unique_ptr<GnuTLS::Profile> profile;
 
  public:
- 	GnuTLSIOHookProvider(Module* mod, GnuTLS::Profile::Config& config)
-		: IOHookProvider(mod, "ssl/" + config.name, IOHookProvider::IOH_SSL)
-		, profile(config)
+ 	GnuTLSIOHookProvider(Module* mod, std::unique_ptr<GnuTLS::Profile>&& prof)
+		: IOHookProvider(mod, "ssl/" + prof->GetName(), IOHookProvider::IOH_SSL)
+		, profile(std::move(prof))
 	{
 		ServerInstance->Modules.AddService(*this);
 	}
@@ -1101,7 +1101,7 @@ class GnuTLSIOHookProvider : public IOHookProvider
 		new GnuTLSIOHook(this, sock, GNUTLS_CLIENT);
 	}
 
-	GnuTLS::Profile& GetProfile() { return profile; }
+	GnuTLS::Profile& GetProfile() { return *profile; }
 };
 
 GnuTLS::Profile& GnuTLSIOHook::GetProfile()
@@ -1122,8 +1122,9 @@ class ModuleSSLGnuTLS : public Module
 	{
 		// First, store all profiles in a new, temporary container. If no problems occur, swap the two
 		// containers; this way if something goes wrong we can go back and continue using the current profiles,
-		// avoiding unpleasant situations where no new TLS (SSL) connections are possible.
-		ProfileList newprofiles;
+		// avoiding unpleasant situations where no new TLS (SSL) connections are possible. Loading the files of
+		// a profile can be slow so the profiles are created as startup tasks.
+		auto newprofiles = std::make_shared<std::vector<std::unique_ptr<GnuTLS::Profile>>>();
 
 		auto tags = ServerInstance->Config->ConfTags("sslprofile");
 		if (tags.empty())
@@ -1144,29 +1145,36 @@ class ModuleSSLGnuTLS : public Module
 				continue;
 			}
 
-			reference<GnuTLSIOHookProvider> prov;
-			try
-			{
-				GnuTLS::Profile::Config profileconfig(name, tag);
-				prov = new GnuTLSIOHookProvider(this, profileconfig);
-			}
-			catch (CoreException& ex)
-			{
-				throw ModuleException("Error while initializing TLS (SSL) profile \"" + name + "\" at " + tag->source.str() + " - " + ex.GetReason());
-			}
-
-			newprofiles.push_back(prov);
+			const size_t idx = newprofiles->size();
+			newprofiles->emplace_back();
+			ServerInstance->Modules.AddStartupTask(this, "TLS (SSL) profile \"" + name + "\"", [newprofiles, idx, name, tag] {
+				try
+				{
+					GnuTLS::Profile::Config profileconfig(name, tag);
+					(*newprofiles)[idx] = std::make_unique<GnuTLS::Profile>(profileconfig);
+				}
+				catch (CoreException& ex)
+				{
+					throw ModuleException("Error while initializing TLS (SSL) profile \"" + name + "\" at " + tag->source.str() + " - " + ex.GetReason());
+				}
+			});
 		}
 
-		// New profiles are ok, begin using them
-		// Old profiles are deleted when their refcount drops to zero
-		for (ProfileList::iterator i = profiles.begin(); i != profiles.end(); ++i)
-		{
-			GnuTLSIOHookProvider& prov = **i;
-			ServerInstance->Modules.DelService(prov);
-		}
+		ServerInstance->Modules.AddStartupTask(this, "TLS (SSL) profiles", nullptr, [this, newprofiles] {
+			ProfileList providers;
+			for (auto& profile : *newprofiles)
+				providers.push_back(new GnuTLSIOHookProvider(this, std::move(profile)));
+
+			// New profiles are ok, begin using them
+			// Old profiles are deleted when their refcount drops to zero
+			for (ProfileList::iterator i = profiles.begin(); i != profiles.end(); ++i)
+			{
+				GnuTLSIOHookProvider& prov = **i;
+				ServerInstance->Modules.DelService(prov);
+			}
 
-		profiles.swap(newprofiles);
+			profiles.swap(providers);
+		});
 	}
 
  public:
@@ -862,12 +862,12 @@ static int OpenSSL::BIOMethod::read(BIO* bio, char* buffer, int size)
 
 class OpenSSLIOHookProvider : public IOHookProvider
 {
-	OpenSSL::Profile profile;
+	std::unique_ptr<OpenSSL::Profile> profile;
 
  public:
-	OpenSSLIOHookProvider(Module* mod, const std::string& profilename, std::shared_ptr<ConfigTag> tag)
-		: IOHookProvider(mod, "ssl/" + profilename, IOHookProvider::IOH_SSL)
-		, profile(profilename, tag)
+	OpenSSLIOHookProvider(Module* mod, std::unique_ptr<OpenSSL::Profile>&& prof)
+		: IOHookProvider(mod, "ssl/" + prof->GetName(), IOHookProvider::IOH_SSL)
+		, profile(std::move(prof))
 	{
 		ServerInstance->Modules.AddService(*this);
 	}
@@ -879,15 +879,15 @@ class OpenSSLIOHookProvider : public IOHookProvider
 
 	void OnAccept(StreamSocket* sock, irc::sockets::sockaddrs* client, irc::sockets::sockaddrs* server) override
 	{
-		new OpenSSLIOHook(this, sock, profile.CreateServerSession());
+		new OpenSSLIOHook(this, sock, profile->CreateServerSession());
 	}
 
 	void OnConnect(StreamSocket* sock) override
 	{
-		new OpenSSLIOHook(this, sock, profile.CreateClientSession());
+		new OpenSSLIOHook(this, sock, profile->CreateClientSession());
 	}
 
-	OpenSSL::Profile& GetProfile() { return profile; }
+	OpenSSL::Profile& GetProfile() { return *profile; }
 };
 
 OpenSSL::Profile& OpenSSLIOHook::GetProfile()
@@ -904,7 +904,10 @@ class ModuleSSLOpenSSL : public Module
 
 	void ReadProfiles()
 	{
-		ProfileList newprofiles;
+		// Loading the certificates and DH parameters of a profile can be slow so
+		// the profiles are created as startup tasks. If creating any of them fails
+		// then the current profiles are kept.
+		auto newprofiles = std::make_shared<std::vector<std::unique_ptr<OpenSSL::Profile>>>();
 		auto tags = ServerInstance->Config->ConfTags("sslprofile");
 		if (tags.empty())
 			throw ModuleException("You have not specified any <sslprofile> tags that are usable by this module!");
@@ -924,26 +927,33 @@ class ModuleSSLOpenSSL : public Module
 				continue;
 			}
 
-			reference<OpenSSLIOHookProvider> prov;
-			try
-			{
-				prov = new OpenSSLIOHookProvider(this, name, tag);
-			}
-			catch (CoreException& ex)
-			{
-				throw ModuleException("Error while initializing TLS (SSL) profile \"" + name + "\" at " + tag->source.str() + " - " + ex.GetReason());
-			}
-
-			newprofiles.push_back(prov);
+			const size_t idx = newprofiles->size();
+			newprofiles->emplace_back();
+			ServerInstance->Modules.AddStartupTask(this, "TLS (SSL) profile \"" + name + "\"", [newprofiles, idx, name, tag] {
+				try
+				{
+					(*newprofiles)[idx] = std::make_unique<OpenSSL::Profile>(name, tag);
+				}
+				catch (CoreException& ex)
+				{
+					throw ModuleException("Error while initializing TLS (SSL) profile \"" + name + "\" at " + tag->source.str() + " - " + ex.GetReason());
+				}
+			});
 		}
 
-		for (ProfileList::iterator i = profiles.begin(); i != profiles.end(); ++i)
-		{
-			OpenSSLIOHookProvider& prov = **i;
-			ServerInstance->Modules.DelService(prov);
-		}
+		ServerInstance->Modules.AddStartupTask(this, "TLS (SSL) profiles", nullptr, [this, newprofiles] {
+			ProfileList providers;
+			for (auto& profile : *newprofiles)
+				providers.push_back(new OpenSSLIOHookProvider(this, std::move(profile)));
+
+			for (ProfileList::iterator i = profiles.begin(); i != profiles.end(); ++i)
+			{
+				OpenSSLIOHookProvider& prov = **i;
+				ServerInstance->Modules.DelService(prov);
+			}
 
-		profiles.swap(newprofiles);
+			profiles.swap(providers);
+		});
 	}
 
  public:
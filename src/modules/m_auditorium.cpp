@@ -47,13 +47,13 @@ namespace
  * This is not the same as OnUserJoin() because that runs only when a real join happens but this runs also when a module
  * such as delayjoin or hostcycle generates a join.
  */
-class JoinHook : public ClientProtocol::EventHook
+class AuditoriumJoinHook : public ClientProtocol::EventHook
 {
 	ModuleAuditorium* const parentmod;
 	bool active;
 
  public:
-	JoinHook(ModuleAuditorium* mod);
+	AuditoriumJoinHook(ModuleAuditorium* mod);
 	void OnEventInit(const ClientProtocol::Event& ev) override;
 	ModResult OnPreEventSend(LocalUser* user, const ClientProtocol::Event& ev, ClientProtocol::MessageList& messagelist) override;
 };
@@ -70,7 +70,7 @@ class ModuleAuditorium
 	bool OpsVisible;
 	bool OpsCanSee;
 	bool OperCanSee;
-	JoinHook joinhook;
+	AuditoriumJoinHook joinhook;
 
  public:
 	ModuleAuditorium()
@@ -132,6 +132,12 @@ class ModuleAuditorium
 		return MOD_RES_DENY;
 	}
 
+	ModResult OnNamesListPrepare(LocalUser* issuer, Channel* chan, unsigned int& format) override
+	{
+		// Which members are shown depends on who is asking.
+		return chan->IsModeSet(&aum) ? MOD_RES_DENY : MOD_RES_PASSTHRU;
+	}
+
 	/** Build CUList for showing this join/part/kick */
 	void BuildExcept(Membership* memb, CUList& excepts)
 	{
@@ -191,19 +197,19 @@ class ModuleAuditorium
 	}
 };
 
-JoinHook::JoinHook(ModuleAuditorium* mod)
+AuditoriumJoinHook::AuditoriumJoinHook(ModuleAuditorium* mod)
 	: ClientProtocol::EventHook(mod, "JOIN", 10)
 	, parentmod(mod)
 {
 }
 
-void JoinHook::OnEventInit(const ClientProtocol::Event& ev)
+void AuditoriumJoinHook::OnEventInit(const ClientProtocol::Event& ev)
 {
 	const ClientProtocol::Events::Join& join = static_cast<const ClientProtocol::Events::Join&>(ev);
 	active = !parentmod->IsVisible(join.GetMember());
 }
 
-ModResult JoinHook::OnPreEventSend(LocalUser* user, const ClientProtocol::Event& ev, ClientProtocol::MessageList& messagelist)
+ModResult AuditoriumJoinHook::OnPreEventSend(LocalUser* user, const ClientProtocol::Event& ev, ClientProtocol::MessageList& messagelist)
 {
 	if (!active)
 		return MOD_RES_PASSTHRU;
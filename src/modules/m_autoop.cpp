@@ -23,6 +23,7 @@
 
 #include "inspircd.h"
 #include "listmode.h"
+#include "modules/extban.h"
 
 enum
 {
@@ -84,11 +85,13 @@ class AutoOpList : public ListModeBase
 class ModuleAutoOp : public Module
 {
 	AutoOpList mh;
+	ExtBan::ManagerRef extbanmgr;
 
  public:
 	ModuleAutoOp()
 		: Module(VF_VENDOR, "Adds channel mode w (autoop) which allows channel operators to define an access list which gives status ranks to users on join.")
 		, mh(this)
+		, extbanmgr(this)
 	{
 	}
 
@@ -97,21 +100,15 @@ class ModuleAutoOp : public Module
 		if (!IS_LOCAL(memb->user))
 			return;
 
-		ListModeBase::ModeList* list = mh.GetList(memb->chan);
-		if (list)
+		ExtBan::Manager::MatchList matches;
+		if (extbanmgr && extbanmgr->FindMatches(&mh, memb->user, memb->chan, nullptr, &matches, true))
 		{
 			Modes::ChangeList changelist;
-			for (ListModeBase::ModeList::iterator it = list->begin(); it != list->end(); it++)
+			for (const ListModeBase::ListItem* entry : matches)
 			{
-				std::string::size_type colon = it->mask.find(':');
-				if (colon == std::string::npos)
-					continue;
-				if (memb->chan->CheckBan(memb->user, it->mask.substr(colon+1)))
-				{
-					PrefixMode* given = mh.FindMode(it->mask.substr(0, colon));
-					if (given)
-						changelist.push_add(given, memb->user->nick);
-				}
+				PrefixMode* given = mh.FindMode(entry->mask.substr(0, entry->mask.find(':')));
+				if (given)
+					changelist.push_add(given, memb->user->nick);
 			}
 			ServerInstance->Modes.Process(ServerInstance->FakeClient, memb->chan, NULL, changelist);
 		}
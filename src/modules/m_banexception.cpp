@@ -52,6 +52,7 @@ class ModuleBanException
 {
  private:
 	BanException be;
+	ExtBan::ManagerRef extbanmgr;
 
  public:
 	ModuleBanException()
@@ -59,6 +60,7 @@ class ModuleBanException
 		, ExtBan::EventListener(this)
 		, ISupport::EventListener(this)
 		, be(this)
+		, extbanmgr(this)
 	{
 	}
 
@@ -69,52 +71,18 @@ class ModuleBanException
 
 	ModResult OnExtBanCheck(User* user, Channel* chan, ExtBan::Base* extban) override
 	{
-		ListModeBase::ModeList* list = be.GetList(chan);
-		if (!list)
+		if (extban->GetType() != ExtBan::Type::ACTING || !extbanmgr)
 			return MOD_RES_PASSTHRU;
 
-		for (const ListModeBase::ListItem& ban : *list)
-		{
-			bool inverted;
-			std::string name, value;
-			if (!ExtBan::Parse(ban.mask, name, value, inverted))
-				continue;
-
-			if (name.size() == 1)
-			{
-				// It is an extban but not this extban.
-				if (name[0] != extban->GetLetter())
-					continue;
-			}
-			else
-			{
-				// It is an extban but not this extban.
-				if (!irc::equals(name, extban->GetName()))
-					continue;
-			}
-
-			return extban->IsMatch(user, chan, value) != inverted ? MOD_RES_ALLOW : MOD_RES_PASSTHRU;
-		}
-		return MOD_RES_PASSTHRU;
+		ExtBan::Acting* acting = static_cast<ExtBan::Acting*>(extban);
+		return extbanmgr->FindMatches(&be, user, chan, acting) ? MOD_RES_ALLOW : MOD_RES_PASSTHRU;
 	}
 
 	ModResult OnCheckChannelBan(User* user, Channel* chan) override
 	{
-		ListModeBase::ModeList* list = be.GetList(chan);
-		if (!list)
-		{
-			// No list, proceed normally
-			return MOD_RES_PASSTHRU;
-		}
-
-		for (ListModeBase::ModeList::iterator it = list->begin(); it != list->end(); it++)
-		{
-			if (chan->CheckBan(user, it->mask))
-			{
-				// They match an entry on the list, so let them in.
-				return MOD_RES_ALLOW;
-			}
-		}
+		// If they match an entry on the list then let them in.
+		if (extbanmgr && extbanmgr->FindMatches(&be, user, chan))
+			return MOD_RES_ALLOW;
 		return MOD_RES_PASSTHRU;
 	}
 
@@ -165,6 +165,10 @@ class Cap::ManagerImpl : public Cap::Manager, public ReloadModule::EventListener
 			Capability* cap = i->second;
 			cap->Unregister();
 		}
+
+		// The bits will be reallocated when the caps are registered again.
+		for (LocalUser* user : ServerInstance->Users.GetLocalUsers())
+			user->capabilities = 0;
 	}
 
 	void AddCap(Cap::Capability* cap) override
@@ -223,17 +227,17 @@ class Cap::ManagerImpl : public Cap::Manager, public ReloadModule::EventListener
 
 	Protocol GetProtocol(LocalUser* user) const
 	{
-		return ((capext.get(user) & CAP_302_BIT) ? CAP_302 : CAP_LEGACY);
+		return ((user->capabilities & CAP_302_BIT) ? CAP_302 : CAP_LEGACY);
 	}
 
 	void Set302Protocol(LocalUser* user)
 	{
-		capext.set(user, capext.get(user) | CAP_302_BIT);
+		capext.SetCaps(user, user->capabilities | CAP_302_BIT);
 	}
 
 	bool HandleReq(LocalUser* user, const std::string& reqlist)
 	{
-		Ext usercaps = capext.get(user);
+		Ext usercaps = user->capabilities;
 		irc::spacesepstream ss(reqlist);
 		for (std::string capname; ss.GetToken(capname); )
 		{
@@ -251,13 +255,13 @@ class Cap::ManagerImpl : public Cap::Manager, public ReloadModule::EventListener
 				usercaps = cap->AddToMask(usercaps);
 		}
 
-		capext.set(user, usercaps);
+		capext.SetCaps(user, usercaps);
 		return true;
 	}
 
 	void HandleList(std::vector<std::string>& out, LocalUser* user, bool show_all, bool show_values, bool minus_prefix = false) const
 	{
-		Ext show_caps = (show_all ? ~0 : capext.get(user));
+		Ext show_caps = (show_all ? ~0 : user->capabilities);
 
 		for (CapMap::const_iterator i = caps.begin(); i != caps.end(); ++i)
 		{
@@ -289,7 +293,7 @@ class Cap::ManagerImpl : public Cap::Manager, public ReloadModule::EventListener
 	void HandleClear(LocalUser* user, std::vector<std::string>& result)
 	{
 		HandleList(result, user, false, false, true);
-		capext.unset(user);
+		capext.SetCaps(user, 0);
 	}
 };
 
@@ -44,11 +44,13 @@ class IdentHost
 {
  private:
 	std::string hostmask;
+	irc::sockets::address_mask hostaddr;
 	std::string newident;
 
  public:
 	IdentHost(const std::string& mask, const std::string& ident)
 		: hostmask(mask)
+		, hostaddr(mask)
 		, newident(ident)
 	{
 	}
@@ -63,7 +65,7 @@ class IdentHost
 		if (!InspIRCd::Match(user->GetRealHost(), hostmask, ascii_case_insensitive_map))
 			return false;
 
-		return InspIRCd::MatchCIDR(user->GetIPString(), hostmask, ascii_case_insensitive_map);
+		return hostaddr.match(user->client_sa, user->GetIPString());
 	}
 };
 
@@ -72,6 +74,7 @@ class WebIRCHost
 {
  private:
 	std::string hostmask;
+	irc::sockets::address_mask hostaddr;
 	std::string fingerprint;
 	std::string password;
 	std::string passhash;
@@ -79,6 +82,7 @@ class WebIRCHost
  public:
 	WebIRCHost(const std::string& mask, const std::string& fp, const std::string& pass, const std::string& hash)
 		: hostmask(mask)
+		, hostaddr(mask)
 		, fingerprint(fp)
 		, password(pass)
 		, passhash(hash)
@@ -101,7 +105,7 @@ class WebIRCHost
 			return true;
 
 		// Does the user's IP address match our hostmask?
-		return InspIRCd::MatchCIDR(user->GetIPString(), hostmask, ascii_case_insensitive_map);
+		return hostaddr.match(user->client_sa, user->GetIPString());
 	}
 };
 
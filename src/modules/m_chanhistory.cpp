@@ -28,7 +28,7 @@
 #include "modules/ircv3_batch.h"
 #include "modules/server.h"
 
-typedef insp::flat_map<std::string, std::string> HistoryTagMap;
+typedef insp::flat_map<std::string, ClientProtocol::TagValue> HistoryTagMap;
 
 struct HistoryItem
 {
@@ -139,15 +139,16 @@ class ModuleChanHistory
 	IRCv3::ServerTime::API servertimemanager;
 	ClientProtocol::MessageTagEvent tagevent;
 
-	void AddTag(ClientProtocol::Message& msg, const std::string& tagkey, std::string& tagval)
+	void AddTag(ClientProtocol::Message& msg, const std::string& tagkey, const ClientProtocol::TagValue& value)
 	{
+		std::string tagval(value.get());
 		const Events::ModuleEventProvider::SubscriberList& list = tagevent.GetSubscribers();
 		for (Events::ModuleEventProvider::SubscriberList::const_iterator i = list.begin(); i != list.end(); ++i)
 		{
 			ClientProtocol::MessageTagProvider* const tagprov = static_cast<ClientProtocol::MessageTagProvider*>(*i);
 			const ModResult res = tagprov->OnProcessTag(ServerInstance->FakeClient, tagkey, tagval);
 			if (res == MOD_RES_ALLOW)
-				msg.AddTag(tagkey, tagprov, tagval);
+				msg.AddTag(tagkey, tagprov, tagval == value.get() ? value : ClientProtocol::TagValue(tagval));
 			else if (res == MOD_RES_DENY)
 				break;
 		}
@@ -233,7 +234,7 @@ class ModuleChanHistory
 			return;
 
 		HistoryList* list = m.ext.get(memb->chan);
-		if (!list)
+		if (!list || ServerInstance->Users.ThrottleOutput(localuser))
 			return;
 
 		if ((prefixmsg) && (!batchcap.IsEnabled(localuser)))
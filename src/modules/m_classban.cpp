@@ -35,6 +35,21 @@ class ClassExtBan
 		LocalUser* luser = IS_LOCAL(user);
 		return luser && InspIRCd::Match(luser->GetClass()->name, text);
 	}
+
+	bool HasMatchKey() const override
+	{
+		return true;
+	}
+
+	bool GetMatchKey(User* user, std::string& key) override
+	{
+		LocalUser* luser = IS_LOCAL(user);
+		if (!luser)
+			return false;
+
+		key = luser->GetClass()->name;
+		return true;
+	}
 };
 
 class ModuleClassBan
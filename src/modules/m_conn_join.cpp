@@ -48,7 +48,7 @@ class JoinTimer : public Timer
 
  public:
 	JoinTimer(LocalUser* u, SimpleExtItem<JoinTimer>& ex, const std::string& chans, unsigned int delay)
-		: Timer(delay, false)
+		: Timer(delay, false, ex.creator)
 		, user(u), channels(chans), ext(ex)
 	{
 		ServerInstance->Timers.AddTimer(this);
@@ -54,12 +54,12 @@ namespace
  * This is not the same as OnUserJoin() because that runs only when a real join happens but this runs also when a module
  * such as hostcycle generates a join.
  */
-class JoinHook : public ClientProtocol::EventHook
+class DelayJoinHook : public ClientProtocol::EventHook
 {
 	const IntExtItem& unjoined;
 
  public:
-	JoinHook(Module* mod, const IntExtItem& unjoinedref)
+	DelayJoinHook(Module* mod, const IntExtItem& unjoinedref)
 		: ClientProtocol::EventHook(mod, "JOIN", 10)
 		, unjoined(unjoinedref)
 	{
@@ -85,7 +85,7 @@ class ModuleDelayJoin
 {
  public:
 	IntExtItem unjoined;
-	JoinHook joinhook;
+	DelayJoinHook joinhook;
 	DelayJoinMode djm;
 
 	ModuleDelayJoin()
@@ -99,6 +99,7 @@ class ModuleDelayJoin
 	}
 
 	ModResult OnNamesListItem(LocalUser* issuer, Membership*, std::string& prefixes, std::string& nick) override;
+	ModResult OnNamesListPrepare(LocalUser* issuer, Channel* chan, unsigned int& format) override;
 	void OnUserJoin(Membership*, bool, bool, CUList&) override;
 	void CleanUser(User* user);
 	void OnUserPart(Membership*, std::string &partmessage, CUList&) override;
@@ -142,6 +143,12 @@ ModResult ModuleDelayJoin::OnNamesListItem(LocalUser* issuer, Membership* memb,
 	return MOD_RES_PASSTHRU;
 }
 
+ModResult ModuleDelayJoin::OnNamesListPrepare(LocalUser* issuer, Channel* chan, unsigned int& format)
+{
+	/* all members are revealed when +D is removed so only +D channels can have hidden members */
+	return chan->IsModeSet(djm) ? MOD_RES_DENY : MOD_RES_PASSTHRU;
+}
+
 static void populate(CUList& except, Membership* memb)
 {
 	const Channel::MemberMap& users = memb->chan->GetUsers();
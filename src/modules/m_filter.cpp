@@ -182,6 +182,16 @@ class CommandFilter : public Command
 	}
 };
 
+/** A filter from the config which has been compiled by a startup task. */
+struct CompiledFilter final
+{
+	/** If compiling succeeded then the compiled filter. */
+	std::unique_ptr<FilterResult> filter;
+
+	/** If compiling failed then the reason why. */
+	std::string error;
+};
+
 class ModuleFilter
 	: public Module
 	, public ServerProtocol::SyncEventListener
@@ -215,6 +225,7 @@ class ModuleFilter
 	FilterResult* FilterMatch(User* user, const std::string &text, int flags);
 	bool DeleteFilter(const std::string& freeform, std::string& reason);
 	std::pair<bool, std::string> AddFilter(const std::string& freeform, FilterAction type, const std::string& reason, unsigned long duration, const std::string& flags, bool config = false);
+	std::pair<bool, std::string> AddFilter(FilterResult&& filter);
 	void ReadConfig(ConfigStatus& status) override;
 	void GetLinkData(std::string& data) override;
 	std::string EncodeFilter(FilterResult* filter);
@@ -795,6 +806,20 @@ std::pair<bool, std::string> ModuleFilter::AddFilter(const std::string& freeform
 	return std::make_pair(true, "");
 }
 
+std::pair<bool, std::string> ModuleFilter::AddFilter(FilterResult&& filter)
+{
+	for (std::vector<FilterResult>::iterator i = filters.begin(); i != filters.end(); i++)
+	{
+		if (i->freeform == filter.freeform)
+		{
+			return std::make_pair(false, "Filter already exists");
+		}
+	}
+
+	filters.push_back(std::move(filter));
+	return std::make_pair(true, "");
+}
+
 bool ModuleFilter::StringToFilterAction(const std::string& str, FilterAction& fa)
 {
 	if (stdalgo::string::equalsci(str, "gline"))
@@ -836,13 +861,13 @@ std::string ModuleFilter::FilterActionToString(FilterAction fa)
 
 void ModuleFilter::ReadFilters()
 {
-	insp::flat_set<std::string> removedfilters;
+	auto removedfilters = std::make_shared<insp::flat_set<std::string>>();
 
 	for (std::vector<FilterResult>::iterator filter = filters.begin(); filter != filters.end(); )
 	{
 		if (filter->from_config)
 		{
-			removedfilters.insert(filter->freeform);
+			removedfilters->insert(filter->freeform);
 			filter = filters.erase(filter);
 			continue;
 		}
@@ -863,18 +888,36 @@ void ModuleFilter::ReadFilters()
 		if (!StringToFilterAction(action, fa))
 			fa = FA_NONE;
 
-		std::pair<bool, std::string> result = static_cast<ModuleFilter*>(this)->AddFilter(pattern, fa, reason, duration, flgs, true);
-		if (result.first)
-			removedfilters.erase(pattern);
-		else
-			ServerInstance->Logs.Log(MODNAME, LOG_DEFAULT, "Filter '%s' could not be added: %s", pattern.c_str(), result.second.c_str());
+		// Compiling a large number of patterns can be slow so they are
+		// compiled as startup tasks and then added in the config order.
+		auto compiled = std::make_shared<CompiledFilter>();
+		ServerInstance->Modules.AddStartupTask(this, "compiling \"" + pattern + "\"", [this, compiled, pattern, reason, fa, duration, flgs] {
+			try
+			{
+				compiled->filter = std::make_unique<FilterResult>(RegexEngine, pattern, reason, fa, duration, flgs, true);
+			}
+			catch (ModuleException& e)
+			{
+				compiled->error = e.GetReason();
+			}
+		}, [this, compiled, pattern, removedfilters] {
+			std::pair<bool, std::string> result(false, compiled->error);
+			if (compiled->filter)
+				result = AddFilter(std::move(*compiled->filter));
+			else
+				ServerInstance->Logs.Log(MODNAME, LOG_DEFAULT, "Error in regular expression '%s': %s", pattern.c_str(), compiled->error.c_str());
+
+			if (result.first)
+				removedfilters->erase(pattern);
+			else
+				ServerInstance->Logs.Log(MODNAME, LOG_DEFAULT, "Filter '%s' could not be added: %s", pattern.c_str(), result.second.c_str());
+		});
 	}
 
-	if (!removedfilters.empty())
-	{
-		for (insp::flat_set<std::string>::const_iterator it = removedfilters.begin(); it != removedfilters.end(); ++it)
+	ServerInstance->Modules.AddStartupTask(this, "removing filters", nullptr, [removedfilters] {
+		for (insp::flat_set<std::string>::const_iterator it = removedfilters->begin(); it != removedfilters->end(); ++it)
 			ServerInstance->SNO.WriteGlobalSno('f', "Removing filter '" + *(it) + "' due to config rehash.");
-	}
+	});
 }
 
 ModResult ModuleFilter::OnStats(Stats::Context& stats)
@@ -50,6 +50,18 @@ class CountryExtBan
 		// Does this user match against the ban?
 		return InspIRCd::Match(code, text);
 	}
+
+	bool HasMatchKey() const override
+	{
+		return true;
+	}
+
+	bool GetMatchKey(User* user, std::string& key) override
+	{
+		Geolocation::Location* location = geoapi ? geoapi->GetLocation(user) : NULL;
+		key = location ? location->GetCode() : "XX";
+		return true;
+	}
 };
 
 class ModuleGeoBan
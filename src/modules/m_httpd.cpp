@@ -202,9 +202,9 @@ class HttpServerSocket : public BufferedSocket, public Timer, public insp::intru
 	}
 
  public:
-	HttpServerSocket(int newfd, const std::string& IP, ListenSocket* via, irc::sockets::sockaddrs* client, irc::sockets::sockaddrs* server, unsigned int timeoutsec)
-		: BufferedSocket(newfd)
-		, Timer(timeoutsec)
+	HttpServerSocket(Module* mod, int newfd, const std::string& IP, ListenSocket* via, irc::sockets::sockaddrs* client, irc::sockets::sockaddrs* server, unsigned int timeoutsec)
+		: BufferedSocket(newfd, mod)
+		, Timer(timeoutsec, false, mod)
 		, ip(IP)
 	{
 		if ((!via->iohookprovs.empty()) && (via->iohookprovs.back()))
@@ -436,7 +436,7 @@ class ModuleHttpServer : public Module
 		if (!stdalgo::string::equalsci(from->bind_tag->getString("type"), "httpd"))
 			return MOD_RES_PASSTHRU;
 
-		sockets.push_front(new HttpServerSocket(nfd, client->addr(), from, client, server, timeoutsec));
+		sockets.push_front(new HttpServerSocket(this, nfd, client->addr(), from, client, server, timeoutsec));
 		return MOD_RES_ALLOW;
 	}
 
@@ -173,8 +173,16 @@ namespace Stats
 		for (ModuleManager::ModuleMap::const_iterator i = mods.begin(); i != mods.end(); ++i)
 		{
 			Module* mod = i->second;
-			data << "<module><name>" << i->first << "</name><description>" << Sanitize(mod->description) << "</description></module>";
+			const ModuleManager::OwnedResources resources = ServerInstance->Modules.GetOwnedResources(mod);
+			data << "<module><name>" << i->first << "</name><description>" << Sanitize(mod->description) << "</description>";
+			data << "<hookcalls>" << mod->hookusage.calls << "</hookcalls><hooktime>" << mod->hookusage.time / 1000 << "</hooktime>";
+			data << "<commandcalls>" << mod->commandusage.calls << "</commandcalls><commandtime>" << mod->commandusage.time / 1000 << "</commandtime>";
+			data << "<services>" << resources.services << "</services><extensions>" << resources.extitems << "</extensions><extensionvalues>"
+				<< resources.extvalues << "</extensionvalues><timers>" << resources.timers << "</timers><sockets>" << resources.sockets
+				<< "</sockets></module>";
 		}
+		data << "<orphaned><timers>" << ServerInstance->Timers.GetOrphanedTimers() << "</timers><sockets>"
+			<< SocketEngine::GetOrphanedHandlers() << "</sockets></orphaned>";
 		return data << "</modulelist>";
 	}
 
@@ -108,7 +108,9 @@ class IdentRequestSocket : public EventHandler
 	time_t age;
 	bool done;			/* True if lookup is finished */
 
-	IdentRequestSocket(LocalUser* u) : user(u)
+	IdentRequestSocket(Module* mod, LocalUser* u)
+		: EventHandler(mod)
+		, user(u)
 	{
 		age = ServerInstance->Time();
 
@@ -341,7 +343,7 @@ class ModuleIdent : public Module
 
 		try
 		{
-			isock = new IdentRequestSocket(user);
+			isock = new IdentRequestSocket(this, user);
 			socket.set(user, isock);
 		}
 		catch (ModuleException &e)
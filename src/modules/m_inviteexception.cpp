@@ -25,6 +25,7 @@
 
 #include "inspircd.h"
 #include "listmode.h"
+#include "modules/extban.h"
 #include "modules/isupport.h"
 
 enum
@@ -51,12 +52,14 @@ class ModuleInviteException
  private:
 	bool invite_bypass_key;
 	InviteException ie;
+	ExtBan::ManagerRef extbanmgr;
 
  public:
 	ModuleInviteException()
 		: Module(VF_VENDOR, "Adds channel mode I (invex) which allows channel operators to exempt user masks from the i (inviteonly) channel mode.")
 		, ISupport::EventListener(this)
 		, ie(this)
+		, extbanmgr(this)
 	{
 	}
 
@@ -67,17 +70,8 @@ class ModuleInviteException
 
 	ModResult OnCheckInvite(User* user, Channel* chan) override
 	{
-		ListModeBase::ModeList* list = ie.GetList(chan);
-		if (list)
-		{
-			for (ListModeBase::ModeList::iterator it = list->begin(); it != list->end(); it++)
-			{
-				if (chan->CheckBan(user, it->mask))
-				{
-					return MOD_RES_ALLOW;
-				}
-			}
-		}
+		if (extbanmgr && extbanmgr->FindMatches(&ie, user, chan))
+			return MOD_RES_ALLOW;
 
 		return MOD_RES_PASSTHRU;
 	}
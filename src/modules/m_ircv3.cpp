@@ -46,7 +46,7 @@ class AwayMessage : public ClientProtocol::Message
 	}
 };
 
-class JoinHook : public ClientProtocol::EventHook
+class ExtendedJoinHook : public ClientProtocol::EventHook
 {
 	ClientProtocol::Events::Join extendedjoinmsg;
 
@@ -57,7 +57,7 @@ class JoinHook : public ClientProtocol::EventHook
  	Cap::Capability extendedjoincap;
 	Cap::Capability awaycap;
 
-	JoinHook(Module* mod)
+	ExtendedJoinHook(Module* mod)
 		: ClientProtocol::EventHook(mod, "JOIN")
 		, asterisk(1, '*')
 		, awayprotoev(mod, "AWAY")
@@ -117,7 +117,7 @@ class ModuleIRCv3
 {
  private:
 	Cap::Capability cap_accountnotify;
-	JoinHook joinhook;
+	ExtendedJoinHook joinhook;
 	ClientProtocol::EventProvider accountprotoev;
 
  public:
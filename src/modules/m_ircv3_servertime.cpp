@@ -31,6 +31,7 @@ class ServerTimeTag
 	time_t lasttime = 0;
 	long lasttimens = 0;
 	std::string lasttimestring;
+	ClientProtocol::TagValue lasttimevalue;
 
 	void RefreshTimeString()
 	{
@@ -43,6 +44,7 @@ class ServerTimeTag
 
 			// Cache the string so it's not recreated every time a message is sent.
 			lasttimestring = IRCv3::ServerTime::FormatTime(currtime, (currtimens ? currtimens / 1000000 : 0));
+			lasttimevalue = lasttimestring;
 		}
 	}
 
@@ -66,7 +68,7 @@ class ServerTimeTag
 	{
 		// Server protocol.
 		RefreshTimeString();
-		tags.insert(std::make_pair(tagname, ClientProtocol::MessageTagData(this, lasttimestring)));
+		tags.insert(std::make_pair(tagname, ClientProtocol::MessageTagData(this, lasttimevalue)));
 	}
 
 };
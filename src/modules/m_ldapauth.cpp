@@ -307,7 +307,7 @@ class ModuleLDAPAuth : public Module
 	std::string base;
 	std::string attribute;
 	std::vector<std::string> allowpatterns;
-	std::vector<std::string> whitelistedcidrs;
+	std::vector<irc::sockets::address_mask> whitelistedcidrs;
 	bool useusername;
 
 public:
@@ -384,9 +384,9 @@ public:
 			}
 		}
 
-		for (std::vector<std::string>::iterator i = whitelistedcidrs.begin(); i != whitelistedcidrs.end(); i++)
+		for (std::vector<irc::sockets::address_mask>::iterator i = whitelistedcidrs.begin(); i != whitelistedcidrs.end(); i++)
 		{
-			if (InspIRCd::MatchCIDR(user->GetIPString(), *i, ascii_case_insensitive_map))
+			if (i->match(user->client_sa, user->GetIPString()))
 			{
 				ldapAuthed.set(user,1);
 				return MOD_RES_PASSTHRU;
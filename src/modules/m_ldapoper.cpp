@@ -71,10 +71,10 @@ class LDAPOperBase : public LDAPInterface
 	}
 };
 
-class BindInterface : public LDAPOperBase
+class OperBindInterface : public LDAPOperBase
 {
  public:
-	BindInterface(Module* mod, const std::string& uuid, const std::string& oper, const std::string& pass)
+	OperBindInterface(Module* mod, const std::string& uuid, const std::string& oper, const std::string& pass)
 		: LDAPOperBase(mod, uuid, oper, pass)
 	{
 	}
@@ -96,7 +96,7 @@ class BindInterface : public LDAPOperBase
 	}
 };
 
-class SearchInterface : public LDAPOperBase
+class OperSearchInterface : public LDAPOperBase
 {
 	const std::string provider;
 
@@ -113,7 +113,7 @@ class SearchInterface : public LDAPOperBase
 			if (bindDn.empty())
 				return false;
 
-			LDAP->Bind(new BindInterface(this->creator, uid, opername, password), bindDn, password);
+			LDAP->Bind(new OperBindInterface(this->creator, uid, opername, password), bindDn, password);
 		}
 		catch (LDAPException& ex)
 		{
@@ -124,7 +124,7 @@ class SearchInterface : public LDAPOperBase
 	}
 
  public:
-	SearchInterface(Module* mod, const std::string& prov, const std::string &uuid, const std::string& oper, const std::string& pass)
+	OperSearchInterface(Module* mod, const std::string& prov, const std::string &uuid, const std::string& oper, const std::string& pass)
 		: LDAPOperBase(mod, uuid, oper, pass)
 		, provider(prov)
 	{
@@ -138,7 +138,7 @@ class SearchInterface : public LDAPOperBase
 	}
 };
 
-class AdminBindInterface : public LDAPInterface
+class OperAdminBindInterface : public LDAPInterface
 {
 	const std::string provider;
 	const std::string user;
@@ -148,7 +148,7 @@ class AdminBindInterface : public LDAPInterface
 	const std::string what;
 
  public:
-	AdminBindInterface(Module* c, const std::string& p, const std::string& u, const std::string& o, const std::string& pa, const std::string& b, const std::string& w)
+	OperAdminBindInterface(Module* c, const std::string& p, const std::string& u, const std::string& o, const std::string& pa, const std::string& b, const std::string& w)
 		: LDAPInterface(c)
 		, provider(p)
 		, user(u)
@@ -166,7 +166,7 @@ class AdminBindInterface : public LDAPInterface
 		{
 			try
 			{
-				LDAP->Search(new SearchInterface(this->creator, provider, user, opername, password), base, what);
+				LDAP->Search(new OperSearchInterface(this->creator, provider, user, opername, password), base, what);
 			}
 			catch (LDAPException& ex)
 			{
@@ -231,7 +231,7 @@ class ModuleLDAPOper : public Module
 			try
 			{
 				std::string what = attribute + "=" + opername;
-				LDAP->BindAsManager(new AdminBindInterface(this, LDAP.GetProvider(), user->uuid, opername, password, base, what));
+				LDAP->BindAsManager(new OperAdminBindInterface(this, LDAP.GetProvider(), user->uuid, opername, password, base, what));
 				return MOD_RES_DENY;
 			}
 			catch (LDAPException& ex)
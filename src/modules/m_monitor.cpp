@@ -245,7 +245,7 @@ class IRCv3::Monitor::Manager
  	WatchedList emptywatchedlist;
 };
 
-void IRCv3::Monitor::Manager::ExtItem::FromInternal(Extensible* container, const std::string& value)
+inline void IRCv3::Monitor::Manager::ExtItem::FromInternal(Extensible* container, const std::string& value)
 {
 	irc::spacesepstream ss(value);
 	for (std::string nick; ss.GetToken(nick); )
@@ -82,6 +82,14 @@ class ModuleNamesX
 		return MOD_RES_PASSTHRU;
 	}
 
+	ModResult OnNamesListPrepare(LocalUser* issuer, Channel* chan, unsigned int& format) override
+	{
+		if (cap.IsEnabled(issuer))
+			format |= Names::FORMAT_ALL_PREFIXES;
+
+		return MOD_RES_PASSTHRU;
+	}
+
 	ModResult OnWhoLine(const Who::Request& request, LocalUser* source, User* user, Membership* memb, Numeric::Numeric& numeric) override
 	{
 		if ((!memb) || (!cap.IsEnabled(source)))
@@ -41,7 +41,8 @@ enum
 class CommandOpermotd : public Command
 {
  public:
-	file_cache opermotd;
+	/** The pre-rendered OPERMOTD numerics or an empty vector if the file is missing. */
+	std::vector<Numeric::Numeric> opermotd;
 
 	CommandOpermotd(Module* Creator) : Command(Creator,"OPERMOTD", 0, 1)
 	{
@@ -72,14 +73,31 @@ class CommandOpermotd : public Command
 			return;
 		}
 
-		user->WriteRemoteNumeric(RPL_OMOTDSTART, "Server operators message of the day");
+		for (const auto& numeric : opermotd)
+			user->WriteRemoteNumeric(numeric);
+	}
+
+	void Render(file_cache contents)
+	{
+		InspIRCd::ProcessColors(contents);
+
+		opermotd.clear();
+		if (contents.empty())
+			return;
+
+		opermotd.reserve(contents.size() + 2);
+
+		opermotd.push_back(Numeric::Numeric(RPL_OMOTDSTART));
+		opermotd.back().push("Server operators message of the day");
 
-		for (file_cache::const_iterator i = opermotd.begin(); i != opermotd.end(); ++i)
+		for (const auto& line : contents)
 		{
-			user->WriteRemoteNumeric(RPL_OMOTD, InspIRCd::Format(" %s", i->c_str()));
+			opermotd.push_back(Numeric::Numeric(RPL_OMOTD));
+			opermotd.back().push(" " + line);
 		}
 
-		user->WriteRemoteNumeric(RPL_ENDOFOMOTD, "End of OPERMOTD");
+		opermotd.push_back(Numeric::Numeric(RPL_ENDOFOMOTD));
+		opermotd.back().push("End of OPERMOTD");
 	}
 };
 
@@ -112,8 +130,7 @@ class ModuleOpermotd : public Module
 		try
 		{
 			FileReader reader(conf->getString("file", "opermotd", 1));
-			cmd.opermotd = reader.GetVector();
-			InspIRCd::ProcessColors(cmd.opermotd);
+			cmd.Render(reader.GetVector());
 		}
 		catch (CoreException&)
 		{
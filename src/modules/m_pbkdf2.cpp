@@ -142,23 +142,23 @@ class PBKDF2Provider : public HashProvider
 	}
 };
 
-struct ProviderConfig
+struct PBKDF2ProviderConfig
 {
 	unsigned long dkey_length;
 	unsigned long iterations;
 };
 
-typedef std::map<std::string, ProviderConfig> ProviderConfigMap;
+typedef std::map<std::string, PBKDF2ProviderConfig> PBKDF2ProviderConfigMap;
 
 class ModulePBKDF2 : public Module
 {
 	std::vector<PBKDF2Provider*> providers;
-	ProviderConfig globalconfig;
-	ProviderConfigMap providerconfigs;
+	PBKDF2ProviderConfig globalconfig;
+	PBKDF2ProviderConfigMap providerconfigs;
 
-	ProviderConfig GetConfigForProvider(const std::string& name) const
+	PBKDF2ProviderConfig GetConfigForProvider(const std::string& name) const
 	{
-		ProviderConfigMap::const_iterator it = providerconfigs.find(name);
+		PBKDF2ProviderConfigMap::const_iterator it = providerconfigs.find(name);
 		if (it == providerconfigs.end())
 			return globalconfig;
 
@@ -170,7 +170,7 @@ class ModulePBKDF2 : public Module
 		for (std::vector<PBKDF2Provider*>::iterator i = providers.begin(); i != providers.end(); ++i)
 		{
 			PBKDF2Provider* pi = *i;
-			ProviderConfig config = GetConfigForProvider(pi->name);
+			PBKDF2ProviderConfig config = GetConfigForProvider(pi->name);
 			pi->iterations = config.iterations;
 			pi->dkey_length = config.dkey_length;
 		}
@@ -180,16 +180,16 @@ class ModulePBKDF2 : public Module
 	{
 		// First set the common values
 		auto tag = ServerInstance->Config->ConfValue("pbkdf2");
-		ProviderConfig newglobal;
+		PBKDF2ProviderConfig newglobal;
 		newglobal.iterations = tag->getUInt("iterations", 12288, 1);
 		newglobal.dkey_length = tag->getUInt("length", 32, 1, 1024);
 
 		// Then the specific values
-		ProviderConfigMap newconfigs;
+		PBKDF2ProviderConfigMap newconfigs;
 		for (auto& [_, ptag] : ServerInstance->Config->ConfTags("pbkdf2prov"))
 		{
 			std::string hash_name = "hash/" + ptag->getString("hash");
-			ProviderConfig& config = newconfigs[hash_name];
+			PBKDF2ProviderConfig& config = newconfigs[hash_name];
 
 			config.iterations = ptag->getUInt("iterations", newglobal.iterations, 1);
 			config.dkey_length = ptag->getUInt("length", newglobal.dkey_length, 1, 1024);
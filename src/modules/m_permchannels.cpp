@@ -176,7 +176,7 @@ public:
 
 	ModulePermanentChannels()
 		: Module(VF_VENDOR, "Adds channel mode P (permanent) which prevents the channel from being deleted when the last user leaves.")
-		, Timer(0, true)
+		, Timer(0, true, this)
 		, p(this)
 	{
 	}
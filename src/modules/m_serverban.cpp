@@ -39,6 +39,17 @@ class ServerExtBan
 	{
 		return InspIRCd::Match(user->server->GetName(), text);
 	}
+
+	bool HasMatchKey() const override
+	{
+		return true;
+	}
+
+	bool GetMatchKey(User* user, std::string& key) override
+	{
+		key = user->server->GetName();
+		return true;
+	}
 };
 
 class ModuleServerBan
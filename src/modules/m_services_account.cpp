@@ -160,6 +160,21 @@ private:
 		const std::string* account = accountext.get(user);
 		return account && InspIRCd::Match(*account, text);
 	}
+
+	bool HasMatchKey() const override
+	{
+		return true;
+	}
+
+	bool GetMatchKey(User* user, std::string& key) override
+	{
+		const std::string* account = accountext.get(user);
+		if (!account)
+			return false;
+
+		key = *account;
+		return true;
+	}
 };
 
 class UnauthedExtBan
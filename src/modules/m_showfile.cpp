@@ -38,12 +38,8 @@ class CommandShowFile : public Command
 		SF_NUMERIC
 	};
 
-	std::string introtext;
-	std::string endtext;
-	unsigned int intronumeric;
-	unsigned int textnumeric;
-	unsigned int endnumeric;
 	file_cache contents;
+	std::vector<Numeric::Numeric> numerics;
 	Method method;
 
  public:
@@ -56,14 +52,8 @@ class CommandShowFile : public Command
 	{
 		if (method == SF_NUMERIC)
 		{
-			if (!introtext.empty() && intronumeric)
-				user->WriteRemoteNumeric(intronumeric, introtext);
-
-			for (file_cache::const_iterator i = contents.begin(); i != contents.end(); ++i)
-				user->WriteRemoteNumeric(textnumeric, InspIRCd::Format(" %s", i->c_str()));
-
-			if (!endtext.empty() && endnumeric)
-				user->WriteRemoteNumeric(endnumeric, endtext.c_str());
+			for (const auto& numeric : numerics)
+				user->WriteRemoteNumeric(numeric);
 		}
 		else if (IS_LOCAL(user))
 		{
@@ -80,11 +70,11 @@ class CommandShowFile : public Command
 
 	void UpdateSettings(std::shared_ptr<ConfigTag> tag, const std::vector<std::string>& filecontents)
 	{
-		introtext = tag->getString("introtext", "Showing " + name);
-		endtext = tag->getString("endtext", "End of " + name);
-		intronumeric = tag->getUInt("intronumeric", RPL_RULESTART, 0, 999);
-		textnumeric = tag->getUInt("numeric", RPL_RULES, 0, 999);
-		endnumeric = tag->getUInt("endnumeric", RPL_RULESEND, 0, 999);
+		const std::string introtext = tag->getString("introtext", "Showing " + name);
+		const std::string endtext = tag->getString("endtext", "End of " + name);
+		const unsigned int intronumeric = tag->getUInt("intronumeric", RPL_RULESTART, 0, 999);
+		const unsigned int textnumeric = tag->getUInt("numeric", RPL_RULES, 0, 999);
+		const unsigned int endnumeric = tag->getUInt("endnumeric", RPL_RULESEND, 0, 999);
 		std::string smethod = tag->getString("method");
 
 		method = SF_NUMERIC;
@@ -95,6 +85,29 @@ class CommandShowFile : public Command
 
 		contents = filecontents;
 		InspIRCd::ProcessColors(contents);
+
+		// Render the numerics here so they don't have to be built every time the command is used.
+		numerics.clear();
+		if (method != SF_NUMERIC)
+			return;
+
+		if (!introtext.empty() && intronumeric)
+		{
+			numerics.push_back(Numeric::Numeric(intronumeric));
+			numerics.back().push(introtext);
+		}
+
+		for (const auto& line : contents)
+		{
+			numerics.push_back(Numeric::Numeric(textnumeric));
+			numerics.back().push(" " + line);
+		}
+
+		if (!endtext.empty() && endnumeric)
+		{
+			numerics.push_back(Numeric::Numeric(endnumeric));
+			numerics.back().push(endtext);
+		}
 	}
 };
 
@@ -20,12 +20,13 @@
 
 #include "inspircd.h"
 
+#include "main.h"
 #include "pingtimer.h"
 #include "treeserver.h"
 #include "commandbuilder.h"
 
 PingTimer::PingTimer(TreeServer* ts)
-	: Timer(Utils->PingFreq)
+	: Timer(Utils->PingFreq, false, Utils->Creator)
 	, server(ts)
 	, state(PS_SENDPING)
 {
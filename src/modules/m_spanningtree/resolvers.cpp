@@ -151,7 +151,7 @@ void SecurityIPResolver::OnError(const DNS::Query *r)
 }
 
 CacheRefreshTimer::CacheRefreshTimer()
-	: Timer(3600, true)
+	: Timer(3600, true, Utils->Creator)
 {
 }
 
@@ -40,7 +40,8 @@
  * and only do minor initialization tasks ourselves.
  */
 TreeSocket::TreeSocket(std::shared_ptr<Link> link, std::shared_ptr<Autoconnect> myac, const irc::sockets::sockaddrs& dest)
-	: linkID(link->Name)
+	: BufferedSocket(Utils->Creator)
+	, linkID(link->Name)
 	, LinkState(CONNECTING)
 	, capab(std::make_unique<CapabData>(dest))
 	, age(ServerInstance->Time())
@@ -76,7 +77,7 @@ TreeSocket::TreeSocket(std::shared_ptr<Link> link, std::shared_ptr<Autoconnect>
 /** Constructor for incoming connections
  */
 TreeSocket::TreeSocket(int newfd, ListenSocket* via, irc::sockets::sockaddrs* client, irc::sockets::sockaddrs* server)
-	: BufferedSocket(newfd)
+	: BufferedSocket(newfd, Utils->Creator)
 	, linkID("inbound from " + client->addr())
 	, LinkState(WAIT_AUTH_1)
 	, capab(std::make_unique<CapabData>(*client))
@@ -380,15 +380,14 @@ void TreeSocket::ProcessConnectedLine(std::string& taglist, std::string& prefix,
 
 	CommandBase::Params newparams(params, tags);
 
-	if (scmd)
-		res = scmd->Handle(who, newparams);
-	else
 	{
-		res = cmd->Handle(who, newparams);
-		if (res == CmdResult::INVALID)
-			throw ProtocolException("Error in command handler");
+		Module::UsageTimer timer(cmdbase->creator->commandusage);
+		res = scmd ? scmd->Handle(who, newparams) : cmd->Handle(who, newparams);
 	}
 
+	if (!scmd && res == CmdResult::INVALID)
+		throw ProtocolException("Error in command handler");
+
 	if (res == CmdResult::SUCCESS)
 		Utils->RouteCommand(server->GetRoute(), cmdbase, newparams, who);
 }
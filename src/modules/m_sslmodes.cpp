@@ -56,6 +56,17 @@ class SSLFPExtBan
 		const std::string fp = sslapi ? sslapi->GetFingerprint(user) : "";
 		return !fp.empty() && InspIRCd::Match(fp, text);
 	}
+
+	bool HasMatchKey() const override
+	{
+		return true;
+	}
+
+	bool GetMatchKey(User* user, std::string& key) override
+	{
+		key = sslapi ? sslapi->GetFingerprint(user) : "";
+		return !key.empty();
+	}
 };
 
 /** Handle channel mode +z
@@ -0,0 +1,245 @@
+/*
+ * InspIRCd -- Internet Relay Chat Daemon
+ *
+ * This file is part of InspIRCd.  InspIRCd is free software: you can
+ * redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, version 2.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "inspircd.h"
+#include "iohook.h"
+
+/* The trace file written by this module consists of an eight byte signature
+ * followed by zero or more records. Each record has a fixed size header which
+ * is followed by a variable length payload. All integers are big endian.
+ *
+ *   uint64_t  timestamp (microseconds since the UNIX epoch)
+ *   uint32_t  connection id (unique for the lifetime of the trace)
+ *   uint8_t   record type (one of TraceRecord)
+ *   uint32_t  payload length
+ *   char[]    payload
+ *
+ * The payload of an open or connect record is "<client endpoint> <server
+ * endpoint>" and the payload of a data record is the raw data which was received
+ * from the socket. Close records do not have a payload.
+ *
+ * The trace can be replayed against a test server with tools/replaytrace. Only
+ * connections which were accepted can be replayed; outbound connections are
+ * recorded so that the trace is complete but are skipped during replay.
+ */
+
+enum TraceRecord : uint8_t
+{
+	// A connection was accepted.
+	TR_OPEN = 0,
+
+	// Data was received on a connection.
+	TR_DATA = 1,
+
+	// A connection was closed.
+	TR_CLOSE = 2,
+
+	// An outbound connection was established.
+	TR_CONNECT = 3
+};
+
+// The signature at the start of every trace file.
+static const char trace_signature[9] = "INSPTRC1";
+
+class TraceFile
+{
+ private:
+	// The file that the trace is being written to.
+	FILE* file = nullptr;
+
+	// The id that will be assigned to the next connection.
+	uint32_t nextid = 0;
+
+	void WriteInt(uint64_t value, size_t bytes)
+	{
+		unsigned char buffer[8];
+		for (size_t idx = bytes; idx > 0; --idx)
+		{
+			buffer[idx - 1] = value & 0xFF;
+			value >>= 8;
+		}
+		fwrite(buffer, 1, bytes, file);
+	}
+
+ public:
+	~TraceFile()
+	{
+		Close();
+	}
+
+	void Close()
+	{
+		if (!file)
+			return;
+
+		fclose(file);
+		file = nullptr;
+	}
+
+	void Flush()
+	{
+		if (file)
+			fflush(file);
+	}
+
+	uint32_t GetNextId()
+	{
+		return nextid++;
+	}
+
+	bool IsOpen() const
+	{
+		return file;
+	}
+
+	bool Open(const std::string& filename, size_t buffersize)
+	{
+		Close();
+		file = fopen(filename.c_str(), "wb");
+		if (!file)
+			return false;
+
+		setvbuf(file, nullptr, _IOFBF, buffersize);
+		fwrite(trace_signature, 1, sizeof(trace_signature) - 1, file);
+		return true;
+	}
+
+	void Write(uint32_t id, TraceRecord type, const char* data, size_t length)
+	{
+		if (!file)
+			return;
+
+		const uint64_t timestamp = uint64_t(ServerInstance->Time()) * 1000000 + ServerInstance->Time_ns() / 1000;
+		WriteInt(timestamp, 8);
+		WriteInt(id, 4);
+		WriteInt(type, 1);
+		WriteInt(length, 4);
+		if (length)
+			fwrite(data, 1, length, file);
+	}
+};
+
+class TrafficCaptureHook : public IOHookMiddle
+{
+ private:
+	// The file that traffic is captured to.
+	TraceFile& trace;
+
+	// The id of this connection within the trace.
+	const uint32_t id;
+
+ public:
+	TrafficCaptureHook(IOHookProvider* hookprov, StreamSocket* sock, TraceFile& tf, TraceRecord type, const std::string& endpoints)
+		: IOHookMiddle(hookprov)
+		, trace(tf)
+		, id(tf.GetNextId())
+	{
+		sock->AddIOHook(this);
+		trace.Write(id, type, endpoints.c_str(), endpoints.length());
+	}
+
+	int OnStreamSocketWrite(StreamSocket* sock, StreamSocket::SendQueue& uppersendq) override
+	{
+		// We only capture inbound traffic.
+		GetSendQ().moveall(uppersendq);
+		return 1;
+	}
+
+	int OnStreamSocketRead(StreamSocket* sock, std::string& destrecvq) override
+	{
+		std::string& recvq = GetRecvQ();
+		trace.Write(id, TR_DATA, recvq.data(), recvq.length());
+		destrecvq.append(recvq);
+		recvq.clear();
+		return 1;
+	}
+
+	void OnStreamSocketClose(StreamSocket* sock) override
+	{
+		trace.Write(id, TR_CLOSE, nullptr, 0);
+	}
+};
+
+class TrafficCaptureHookProvider : public IOHookProvider
+{
+ public:
+	TraceFile trace;
+
+	TrafficCaptureHookProvider(Module* mod)
+		: IOHookProvider(mod, "trafficcapture", IOHookProvider::IOH_UNKNOWN, true)
+	{
+	}
+
+	void OnAccept(StreamSocket* sock, irc::sockets::sockaddrs* client, irc::sockets::sockaddrs* server) override
+	{
+		new TrafficCaptureHook(this, sock, trace, TR_OPEN, client->str() + " " + server->str());
+	}
+
+	void OnConnect(StreamSocket* sock) override
+	{
+		// This is only called for outbound server links which specify this
+		// hook in the ssl field of their <link> block.
+		irc::sockets::sockaddrs local;
+		irc::sockets::sockaddrs remote;
+		socklen_t locallen = sizeof(local);
+		socklen_t remotelen = sizeof(remote);
+		std::string endpoints;
+		if (!getsockname(sock->GetFd(), &local.sa, &locallen) && !getpeername(sock->GetFd(), &remote.sa, &remotelen))
+			endpoints = local.str() + " " + remote.str();
+
+		new TrafficCaptureHook(this, sock, trace, TR_CONNECT, endpoints);
+	}
+};
+
+class ModuleTrafficCapture : public Module
+{
+ private:
+	reference<TrafficCaptureHookProvider> hookprov;
+	std::string filename;
+
+ public:
+	ModuleTrafficCapture()
+		: Module(VF_VENDOR, "Allows capturing the traffic received on a <bind> or <link> block to a file so that it can be replayed later.")
+		, hookprov(new TrafficCaptureHookProvider(this))
+	{
+	}
+
+	void ReadConfig(ConfigStatus& status) override
+	{
+		auto tag = ServerInstance->Config->ConfValue("trafficcapture");
+		const std::string newfilename = ServerInstance->Config->Paths.PrependData(tag->getString("filename", "capture.trace", 1));
+		const size_t buffersize = tag->getUInt("buffersize", 1024*1024, 4096);
+
+		// Reopening the file would truncate the existing capture so only do it
+		// when the file name has changed.
+		if (newfilename == filename && hookprov->trace.IsOpen())
+			return;
+
+		if (!hookprov->trace.Open(newfilename, buffersize))
+			throw ModuleException("Unable to open " + newfilename + " for writing: " + strerror(errno));
+
+		filename = newfilename;
+		ServerInstance->Logs.Log(MODNAME, LOG_DEFAULT, "Capturing traffic to %s", filename.c_str());
+	}
+
+	void OnBackgroundTimer(time_t) override
+	{
+		hookprov->trace.Flush();
+	}
+};
+
+MODULE_INIT(ModuleTrafficCapture)
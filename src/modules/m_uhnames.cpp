@@ -78,6 +78,14 @@ class ModuleUHNames
 
 		return MOD_RES_PASSTHRU;
 	}
+
+	ModResult OnNamesListPrepare(LocalUser* issuer, Channel* chan, unsigned int& format) override
+	{
+		if (cap.IsEnabled(issuer))
+			format |= Names::FORMAT_USERHOST;
+
+		return MOD_RES_PASSTHRU;
+	}
 };
 
 MODULE_INIT(ModuleUHNames)
@@ -34,7 +34,7 @@ static dynamic_reference_nocheck<HashProvider>* sha1;
 struct WebSocketConfig
 {
 	typedef std::vector<std::string> OriginList;
-	typedef std::vector<std::string> ProxyRanges;
+	typedef std::vector<irc::sockets::address_mask> ProxyRanges;
 
 	// The HTTP origins that can connect to the server.
 	OriginList allowedorigins;
@@ -365,7 +365,7 @@ class WebSocketHook : public IOHookMiddle
 
 			for (WebSocketConfig::ProxyRanges::const_iterator iter = config.proxyranges.begin(); iter != config.proxyranges.end(); ++iter)
 			{
-				if (InspIRCd::MatchCIDR(luser->GetIPString(), *iter, ascii_case_insensitive_map))
+				if (iter->match(luser->client_sa, luser->GetIPString()))
 				{
 					// Give the user their real IP address.
 					if (realsa != luser->client_sa)
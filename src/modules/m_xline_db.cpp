@@ -35,13 +35,23 @@ class ModuleXLineDB
 	, public Timer
 {
  private:
+	/** The contents of the X-line database as read from disk. */
+	struct DatabaseContents final
+	{
+		/** If non-zero then the error which occurred whilst reading the database. */
+		int error = 0;
+
+		/** The lines which were read from the database. */
+		std::vector<std::string> lines;
+	};
+
 	bool dirty;
 	std::string xlinedbpath;
 
  public:
 	ModuleXLineDB()
 		: Module(VF_VENDOR, "Allows X-lines to be saved and reloaded on restart.")
-		, Timer(0, true)
+		, Timer(0, true, this)
 	{
 	}
 
@@ -57,10 +67,15 @@ class ModuleXLineDB
 		xlinedbpath = ServerInstance->Config->Paths.PrependData(Conf->getString("filename", "xline.db", 1));
 		SetInterval(Conf->getDuration("saveperiod", 5));
 
-		// Read xlines before attaching to events
-		ReadDatabase();
-
-		dirty = false;
+		// Reading a large database from disk can be slow so the file is read
+		// as a startup task and then parsed once it has been read.
+		auto contents = std::make_shared<DatabaseContents>();
+		ServerInstance->Modules.AddStartupTask(this, "reading " + xlinedbpath, [this, contents] {
+			ReadFile(*contents);
+		}, [this, contents] {
+			ReadDatabase(*contents);
+			dirty = false;
+		});
 	}
 
 	/** Called whenever an xline is added by a local user.
@@ -168,22 +183,34 @@ class ModuleXLineDB
 		return true;
 	}
 
-	bool ReadDatabase()
+	/** Reads the lines of the database from disk. This may be called on a worker thread. */
+	void ReadFile(DatabaseContents& contents)
 	{
 		// If the xline database doesn't exist then we don't need to load it.
 		if (!FileSystem::FileExists(xlinedbpath))
-			return true;
+			return;
 
 		std::ifstream stream(xlinedbpath);
 		if (!stream.is_open())
 		{
-			ServerInstance->Logs.Log(MODNAME, LOG_DEBUG, "Cannot read database \"%s\"! %s (%d)", xlinedbpath.c_str(), strerror(errno), errno);
-			ServerInstance->SNO.WriteToSnoMask('x', "database: cannot read xline db \"%s\": %s (%d)", xlinedbpath.c_str(), strerror(errno), errno);
+			contents.error = errno;
+			return;
+		}
+
+		for (std::string line; std::getline(stream, line); )
+			contents.lines.push_back(std::move(line));
+	}
+
+	bool ReadDatabase(const DatabaseContents& contents)
+	{
+		if (contents.error)
+		{
+			ServerInstance->Logs.Log(MODNAME, LOG_DEBUG, "Cannot read database \"%s\"! %s (%d)", xlinedbpath.c_str(), strerror(contents.error), contents.error);
+			ServerInstance->SNO.WriteToSnoMask('x', "database: cannot read xline db \"%s\": %s (%d)", xlinedbpath.c_str(), strerror(contents.error), contents.error);
 			return false;
 		}
 
-		std::string line;
-		while (std::getline(stream, line))
+		for (const auto& line : contents.lines)
 		{
 			// Inspired by the command parser. :)
 			irc::tokenstream tokens(line);
@@ -203,7 +230,6 @@ class ModuleXLineDB
 			{
 				if (command_p[1] != "1")
 				{
-					stream.close();
 					ServerInstance->Logs.Log(MODNAME, LOG_DEBUG, "I got database version %s - I don't understand it", command_p[1].c_str());
 					ServerInstance->SNO.WriteToSnoMask('x', "database: I got a database version (%s) I don't understand", command_p[1].c_str());
 					return false;
@@ -231,7 +257,6 @@ class ModuleXLineDB
 					delete xl;
 			}
 		}
-		stream.close();
 		return true;
 	}
 };
@@ -443,6 +443,32 @@ bool irc::sockets::cidr_mask::match(const irc::sockets::sockaddrs& addr) const
 {
 	if (addr.family() != type)
 		return false;
-	irc::sockets::cidr_mask tmp(addr, length);
-	return tmp == *this;
+
+	const unsigned char* base;
+	switch (type)
+	{
+		case AF_INET:
+			base = reinterpret_cast<const unsigned char*>(&addr.in4.sin_addr);
+			break;
+
+		case AF_INET6:
+			base = reinterpret_cast<const unsigned char*>(&addr.in6.sin6_addr);
+			break;
+
+		default:
+			// UNIX sockets don't support CIDR so all masks of this type match.
+			return true;
+	}
+
+	// Compare the whole bytes directly and then the remaining bits of the partial byte (if any).
+	const unsigned int border = length / 8;
+	if (memcmp(bits, base, border) != 0)
+		return false;
+
+	const unsigned int remainder = length & 7;
+	if (!remainder)
+		return true;
+
+	const unsigned char bitmask = (0xFF00 >> remainder) & 0xFF;
+	return (base[border] & bitmask) == bits[border];
 }
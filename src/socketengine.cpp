@@ -41,24 +41,55 @@ size_t SocketEngine::CurrentSetSize = 0;
 
 /** List of handlers that want a trial read/write
  */
-std::set<int> SocketEngine::trials;
+EventHandler* SocketEngine::trialhead = nullptr;
+EventHandler* SocketEngine::trialtail = nullptr;
+unsigned long SocketEngine::trialgen = 1;
 
 size_t SocketEngine::MaxSetSize = 0;
 
+std::unordered_map<unsigned long, size_t> SocketEngine::OwnedHandlers;
+size_t SocketEngine::OrphanedHandlers = 0;
+
 /** Socket engine statistics: count of various events, bandwidth usage
  */
 SocketEngine::Statistics SocketEngine::stats;
 
-EventHandler::EventHandler()
+EventHandler::EventHandler(Module* mod)
+	: owner(mod)
+	, ownerserial(mod ? mod->serial : 0)
 {
 	fd = -1;
 	event_mask = 0;
+	if (owner)
+		SocketEngine::OwnedHandlers[ownerserial]++;
+}
+
+EventHandler::~EventHandler()
+{
+	SocketEngine::DelTrial(this);
+	if (!owner)
+		return;
+
+	// If the owner has already been destroyed this handler was counted as orphaned.
+	auto it = SocketEngine::OwnedHandlers.find(ownerserial);
+	if (it == SocketEngine::OwnedHandlers.end())
+		SocketEngine::OrphanedHandlers--;
+	else if (!--it->second)
+		SocketEngine::OwnedHandlers.erase(it);
 }
 
 void EventHandler::SwapInternals(EventHandler& other)
 {
 	std::swap(fd, other.fd);
 	std::swap(event_mask, other.event_mask);
+
+	// A pending trial belongs to the fd so it has to move with it.
+	if (!trialgen != !other.trialgen)
+	{
+		EventHandler* const pending = trialgen ? this : &other;
+		SocketEngine::DelTrial(pending);
+		SocketEngine::AddTrial(pending == this ? &other : this);
+	}
 }
 
 void EventHandler::SetFd(int FD)
@@ -110,9 +141,9 @@ void SocketEngine::ChangeEventMask(EventHandler* eh, int change)
 	if (change & FD_WANT_WRITE_MASK)
 		new_m &= ~FD_WANT_WRITE_MASK;
 
-	// if adding a trial read/write, insert it into the set
-	if (change & FD_TRIAL_NOTE_MASK && !(old_m & FD_TRIAL_NOTE_MASK))
-		trials.insert(eh->GetFd());
+	// if adding a trial read/write, add it to the trial list
+	if (change & FD_TRIAL_NOTE_MASK)
+		AddTrial(eh);
 
 	new_m |= change;
 	if (new_m == old_m)
@@ -122,18 +153,61 @@ void SocketEngine::ChangeEventMask(EventHandler* eh, int change)
 	OnSetEvent(eh, old_m, new_m);
 }
 
+void SocketEngine::AddTrial(EventHandler* eh)
+{
+	if (eh->trialgen)
+		return;
+
+	eh->trialgen = trialgen;
+	eh->trialprev = trialtail;
+	eh->trialnext = nullptr;
+	if (trialtail)
+		trialtail->trialnext = eh;
+	else
+		trialhead = eh;
+	trialtail = eh;
+}
+
+void SocketEngine::DelTrial(EventHandler* eh)
+{
+	if (!eh->trialgen)
+		return;
+
+	eh->trialgen = 0;
+	if (eh->trialprev)
+		eh->trialprev->trialnext = eh->trialnext;
+	else
+		trialhead = eh->trialnext;
+	if (eh->trialnext)
+		eh->trialnext->trialprev = eh->trialprev;
+	else
+		trialtail = eh->trialprev;
+	eh->trialprev = eh->trialnext = nullptr;
+}
+
+unsigned int SocketEngine::GetDispatchTimeout()
+{
+	// Pending trials have to be dispatched without waiting for other events.
+	if (trialhead)
+		return 0;
+
+	return ServerInstance->Timers.GetTimeout(MAX_DISPATCH_TIMEOUT);
+}
+
 void SocketEngine::DispatchTrialWrites()
 {
-	std::vector<int> working_list;
-	working_list.reserve(trials.size());
-	working_list.assign(trials.begin(), trials.end());
-	trials.clear();
-	for(unsigned int i=0; i < working_list.size(); i++)
+	// Handlers which ask for another trial while the list is being dispatched
+	// are part of the next generation and are left for the next call.
+	const unsigned long currgen = trialgen++;
+	while (trialhead && trialhead->trialgen <= currgen)
 	{
-		int fd = working_list[i];
-		EventHandler* eh = GetRef(fd);
-		if (!eh)
+		EventHandler* eh = trialhead;
+		DelTrial(eh);
+
+		// The handler may have been removed from the socket engine since it asked for a trial.
+		if (!eh->HasFd() || GetRef(eh->GetFd()) != eh)
 			continue;
+
 		int mask = eh->event_mask;
 		eh->event_mask &= ~(FD_ADD_TRIAL_READ | FD_ADD_TRIAL_WRITE);
 		if ((mask & (FD_ADD_TRIAL_READ | FD_READ_WILL_BLOCK)) == FD_ADD_TRIAL_READ)
@@ -164,6 +238,7 @@ void SocketEngine::DelFdRef(EventHandler *eh)
 		ref[fd] = NULL;
 		CurrentSetSize--;
 	}
+	DelTrial(eh);
 }
 
 bool SocketEngine::HasFd(int fd)
@@ -178,6 +253,24 @@ EventHandler* SocketEngine::GetRef(int fd)
 	return ref[fd];
 }
 
+size_t SocketEngine::GetOwnedHandlers(const Module* mod)
+{
+	auto it = OwnedHandlers.find(mod->serial);
+	return it == OwnedHandlers.end() ? 0 : it->second;
+}
+
+size_t SocketEngine::OrphanHandlers(const Module* mod)
+{
+	auto it = OwnedHandlers.find(mod->serial);
+	if (it == OwnedHandlers.end())
+		return 0;
+
+	const size_t count = it->second;
+	OrphanedHandlers += count;
+	OwnedHandlers.erase(it);
+	return count;
+}
+
 bool SocketEngine::BoundsCheckFd(EventHandler* eh)
 {
 	return eh && eh->HasFd();
@@ -165,9 +165,10 @@ void SocketEngine::OnSetEvent(EventHandler* eh, int old_mask, int new_mask)
 
 int SocketEngine::DispatchEvents()
 {
+	const unsigned int timeout = GetDispatchTimeout();
 	struct timespec ts;
-	ts.tv_nsec = 0;
-	ts.tv_sec = 1;
+	ts.tv_nsec = (timeout % 1000) * 1000000;
+	ts.tv_sec = timeout / 1000;
 
 	int i = kevent(EngineHandle, &changelist.front(), ChangePos, &ke_list.front(), ke_list.size(), &ts);
 	ChangePos = 0;
@@ -29,47 +29,116 @@
 void Timer::SetInterval(unsigned int newinterval)
 {
 	ServerInstance->Timers.DelTimer(this);
-	secs = newinterval;
-	SetTrigger(ServerInstance->Time() + newinterval);
+	interval = uint64_t(newinterval) * 1000;
+	trigger = uint64_t(ServerInstance->Time()) * 1000 + interval;
 	ServerInstance->Timers.AddTimer(this);
 }
 
-Timer::Timer(unsigned int secs_from_now, bool repeating)
-	: trigger(ServerInstance->Time() + secs_from_now)
-	, secs(secs_from_now)
+void Timer::SetInterval(std::chrono::milliseconds newinterval)
+{
+	ServerInstance->Timers.DelTimer(this);
+	interval = newinterval.count();
+	trigger = ServerInstance->Time_ms() + interval;
+	ServerInstance->Timers.AddTimer(this);
+}
+
+Timer::Timer(unsigned int secs_from_now, bool repeating, Module* mod)
+	: trigger((uint64_t(ServerInstance->Time()) + secs_from_now) * 1000)
+	, interval(uint64_t(secs_from_now) * 1000)
+	, repeat(repeating)
+	, owner(mod)
+	, ownerserial(mod ? mod->serial : 0)
+{
+	if (owner)
+		ServerInstance->Timers.OwnedTimers[ownerserial]++;
+}
+
+Timer::Timer(std::chrono::milliseconds ms_from_now, bool repeating, Module* mod)
+	: trigger(ServerInstance->Time_ms() + ms_from_now.count())
+	, interval(ms_from_now.count())
 	, repeat(repeating)
+	, owner(mod)
+	, ownerserial(mod ? mod->serial : 0)
 {
+	if (owner)
+		ServerInstance->Timers.OwnedTimers[ownerserial]++;
 }
 
 Timer::~Timer()
 {
 	ServerInstance->Timers.DelTimer(this);
+	if (!owner)
+		return;
+
+	// If the owner has already been destroyed this timer was counted as orphaned.
+	auto& owned = ServerInstance->Timers.OwnedTimers;
+	auto it = owned.find(ownerserial);
+	if (it == owned.end())
+		ServerInstance->Timers.OrphanedTimers--;
+	else if (!--it->second)
+		owned.erase(it);
 }
 
-void TimerManager::TickTimers(time_t TIME)
+void TimerManager::TickTimers(uint64_t now)
 {
+	// If the clock has gone backwards then move the pending timers back by the
+	// same amount so they still trigger after the interval they asked for.
+	if (now < lasttick)
+	{
+		const uint64_t skip = lasttick - now;
+		TimerMap skipped;
+		for (const auto& [trigger, t] : Timers)
+		{
+			t->trigger = trigger > skip ? trigger - skip : 0;
+			skipped.emplace_hint(skipped.end(), t->trigger, t);
+		}
+		Timers.swap(skipped);
+	}
+	lasttick = now;
+
 	for (TimerMap::iterator i = Timers.begin(); i != Timers.end(); )
 	{
 		Timer* t = i->second;
-		if (t->GetTrigger() > TIME)
+		if (t->trigger > now)
 			break;
 
 		Timers.erase(i++);
 
-		if (!t->Tick(TIME))
+		if (!t->Tick(now / 1000))
 			continue;
 
 		if (t->GetRepeat())
 		{
-			t->SetTrigger(TIME + t->GetInterval());
+			// Keep repeating timers on their original schedule unless they
+			// have fallen more than an interval behind it.
+			t->trigger += t->interval;
+			if (t->trigger <= now)
+				t->trigger = now + t->interval;
 			AddTimer(t);
 		}
 	}
 }
 
+unsigned int TimerManager::GetTimeout(unsigned int maxtimeout) const
+{
+	if (Timers.empty())
+		return maxtimeout;
+
+	// Wake up for the last timer which is due within COALESCE_MS of the next
+	// one so that timers which are close together are ticked at once.
+	TimerMap::const_iterator last = Timers.upper_bound(Timers.begin()->first + COALESCE_MS);
+	const uint64_t trigger = (--last)->first;
+
+	const uint64_t now = ServerInstance->Time_ms();
+	if (trigger <= now)
+		return 0;
+
+	return std::min<uint64_t>(trigger - now, maxtimeout);
+}
+
 void TimerManager::DelTimer(Timer* t)
 {
-	std::pair<TimerMap::iterator, TimerMap::iterator> itpair = Timers.equal_range(t->GetTrigger());
+	std::pair<TimerMap::iterator, TimerMap::iterator> itpair = Timers.equal_range(t->GetTriggerMS());
 
 	for (TimerMap::iterator i = itpair.first; i != itpair.second; ++i)
 	{
@@ -83,5 +152,23 @@ void TimerManager::DelTimer(Timer* t)
 
 void TimerManager::AddTimer(Timer* t)
 {
-	Timers.insert(std::make_pair(t->GetTrigger(), t));
+	Timers.insert(std::make_pair(t->GetTriggerMS(), t));
+}
+
+size_t TimerManager::GetOwnedTimers(const Module* mod) const
+{
+	auto it = OwnedTimers.find(mod->serial);
+	return it == OwnedTimers.end() ? 0 : it->second;
+}
+
+size_t TimerManager::OrphanTimers(const Module* mod)
+{
+	auto it = OwnedTimers.find(mod->serial);
+	if (it == OwnedTimers.end())
+		return 0;
+
+	const size_t count = it->second;
+	OrphanedTimers += count;
+	OwnedTimers.erase(it);
+	return count;
 }
@@ -98,6 +98,48 @@ namespace
 		}
 	}
 
+	void CheckSendQBudget(const UserManager::LocalList& users)
+	{
+		// Only the output queued for users who are not exempt from the hard sendq
+		// limit is budgeted. Server links, other sockets and exempt users are never
+		// disconnected because of the budget.
+		const unsigned long budget = ServerInstance->Config->SendQBudget;
+		if (!budget || StreamSocket::SendQueue::GetUserBytes() <= budget)
+			return;
+
+		// Users who are already quitting will free their sendq anyway.
+		size_t total = 0;
+		std::vector<std::pair<size_t, LocalUser*>> candidates;
+		for (LocalUser* user : users)
+		{
+			const size_t sendqsize = user->eh.GetSendQ().bytes();
+			if (sendqsize && !user->quitting && !user->quitting_sendq && !user->HasPrivPermission("users/flood/increased-buffers"))
+			{
+				candidates.emplace_back(sendqsize, user);
+				total += sendqsize;
+			}
+		}
+		if (total <= budget)
+			return;
+
+		// The users who are furthest behind on reading their output are disconnected first.
+		std::sort(candidates.begin(), candidates.end(), [](const std::pair<size_t, LocalUser*>& lhs, const std::pair<size_t, LocalUser*>& rhs) {
+			return lhs.first > rhs.first;
+		});
+
+		for (const auto& [sendqsize, user] : candidates)
+		{
+			if (total <= budget)
+				break;
+
+			ServerInstance->SNO.WriteGlobalSno('a', "User %s with a SendQ of %zu bytes was disconnected because the total SendQ of %zu bytes exceeds the budget of %lu bytes",
+				user->nick.c_str(), sendqsize, total, budget);
+			total -= sendqsize;
+			ServerInstance->stats.SendQEvicted++;
+			ServerInstance->Users.QuitUser(user, "SendQ exceeded");
+		}
+	}
+
 	void CheckModulesReady(LocalUser* user)
 	{
 		ModResult res;
@@ -130,6 +172,42 @@ UserManager::~UserManager()
 	}
 }
 
+bool UserManager::IsBannedConnection(const irc::sockets::sockaddrs& client, std::string& reason)
+{
+	const std::string ipstr = client.addr();
+
+	BanCacheHit* const b = ServerInstance->BanCache.GetHit(ipstr);
+	if (b && b->Type.empty())
+		return false;
+
+	XLine* zline = NULL;
+	if (!b)
+	{
+		zline = ServerInstance->XLines->MatchesLine("Z", ipstr);
+		if (!zline)
+			return false;
+	}
+
+	// The real checks in AddUser() consult the E-lines before applying a ban so
+	// let any connection which might be exempt through to them. This is only
+	// done once we know the address is banned to keep the common case cheap.
+	if (ServerInstance->XLines->MatchesLine("E", "*@" + ipstr))
+		return false;
+
+	if (b)
+	{
+		ServerInstance->Logs.Log("BANCACHE", LOG_DEBUG, "BanCache: Positive hit for " + ipstr);
+		reason = ServerInstance->Config->HideBans ? b->Type + "-lined" : b->Reason;
+		return true;
+	}
+
+	const std::string banreason = "Z-lined: " + zline->reason;
+	ServerInstance->Logs.Log("BANCACHE", LOG_DEBUG, "BanCache: Adding positive hit (Z) for " + ipstr);
+	ServerInstance->BanCache.AddHit(ipstr, zline->type, banreason, (zline->duration > 0 ? (zline->expiry - ServerInstance->Time()) : 0));
+	reason = ServerInstance->Config->HideBans ? "Z-lined" : banreason;
+	return true;
+}
+
 void UserManager::AddUser(int socket, ListenSocket* via, irc::sockets::sockaddrs* client, irc::sockets::sockaddrs* server)
 {
 	// User constructor allocates a new UUID for the user and inserts it into the uuidlist
@@ -386,21 +464,19 @@ void UserManager::ServerNoticeAll(const char* text, ...)
  */
 void UserManager::DoBackgroundUserStuff()
 {
+	CheckSendQBudget(local_users);
+
 	for (LocalList::iterator i = local_users.begin(); i != local_users.end(); )
 	{
 		// It's possible that we quit the user below due to ping timeout etc. and QuitUser() removes it from the list
 		LocalUser* curr = *i;
 		++i;
 
-		if (curr->CommandFloodPenalty || curr->eh.GetSendQSize())
-		{
-			unsigned int rate = curr->MyClass->GetCommandRate();
-			if (curr->CommandFloodPenalty > rate)
-				curr->CommandFloodPenalty -= rate;
-			else
-				curr->CommandFloodPenalty = 0;
+		// Lines held back by fake lag are processed by the user's fake lag
+		// timer but lines held back because of a full sendq are retried here,
+		// including once the sendq has been completely flushed.
+		if (curr->eh.GetSendQSize() || curr->eh.HasPendingLine())
 			curr->eh.OnDataReady();
-		}
 
 		switch (curr->registered)
 		{
@@ -419,6 +495,19 @@ void UserManager::DoBackgroundUserStuff()
 	}
 }
 
+bool UserManager::ThrottleOutput(LocalUser* user)
+{
+	const unsigned long budget = ServerInstance->Config->SendQBudget;
+	if (!budget || StreamSocket::SendQueue::GetUserBytes() < budget / 4 * 3)
+		return false;
+
+	if (user->HasPrivPermission("users/flood/increased-buffers"))
+		return false;
+
+	ServerInstance->stats.SendQThrottled++;
+	return true;
+}
+
 already_sent_t UserManager::NextAlreadySentId()
 {
 	if (++already_sent_id == 0)
@@ -226,11 +226,48 @@ bool LocalUser::HasSnomaskPermission(char chr) const
 	return this->oper->AllowedSnomasks[chr - 'A'];
 }
 
+UserIOHandler::UserIOHandler(LocalUser* me)
+	: StreamSocket(StreamSocket::SS_USER)
+	, checked_until(0)
+	, lastpenaltydecay(ServerInstance->Time_ms())
+	, fakelagtimer(*this)
+	, user(me)
+{
+	GetSendQ().SetUserQueue(true);
+}
+
+void UserIOHandler::DecayPenalty()
+{
+	const uint64_t now = ServerInstance->Time_ms();
+	if (!user->CommandFloodPenalty || now < lastpenaltydecay)
+	{
+		lastpenaltydecay = now;
+		return;
+	}
+
+	// The penalty is reduced by the command rate every second so work out how
+	// much of it has expired and only consume the time which was used for it.
+	const uint64_t rate = user->MyClass->GetCommandRate();
+	const uint64_t expired = (now - lastpenaltydecay) * rate / 1000;
+	if (expired >= user->CommandFloodPenalty)
+	{
+		user->CommandFloodPenalty = 0;
+		lastpenaltydecay = now;
+	}
+	else
+	{
+		user->CommandFloodPenalty -= expired;
+		lastpenaltydecay += expired * 1000 / rate;
+	}
+}
+
 void UserIOHandler::OnDataReady()
 {
 	if (user->quitting)
 		return;
 
+	DecayPenalty();
+
 	if (recvq.length() > user->MyClass->GetRecvqMax() && !user->HasPrivPermission("users/flood/increased-buffers"))
 	{
 		ServerInstance->Users.QuitUser(user, "RecvQ exceeded");
@@ -300,8 +337,24 @@ void UserIOHandler::OnDataReady()
 		line.clear();
 	}
 
-	if (user->CommandFloodPenalty >= penaltymax && !user->MyClass->fakelag)
-		ServerInstance->Users.QuitUser(user, "Excess Flood");
+	if (user->CommandFloodPenalty >= penaltymax)
+	{
+		if (!user->MyClass->fakelag)
+		{
+			ServerInstance->Users.QuitUser(user, "Excess Flood");
+			return;
+		}
+
+		// Wake up as soon as enough of the penalty has expired to process the next line.
+		if (recvq.find('\n') != std::string::npos)
+		{
+			const uint64_t rate = user->MyClass->GetCommandRate();
+			const uint64_t excess = user->CommandFloodPenalty - penaltymax + 1;
+			const uint64_t wakeup = lastpenaltydecay + (excess * 1000 + rate - 1) / rate;
+			const uint64_t now = ServerInstance->Time_ms();
+			fakelagtimer.SetInterval(std::chrono::milliseconds(wakeup > now ? wakeup - now : 0));
+		}
+	}
 }
 
 void UserIOHandler::AddWriteBuf(const std::string &data)
@@ -410,8 +463,13 @@ void User::Oper(std::shared_ptr<OperInfo> info)
 
 	// Expand permissions from config for faster lookup
 	if (localuser)
+	{
 		oper->init();
 
+		// Users who are exempt from the hard sendq limit are also exempt from the sendq budget.
+		localuser->eh.GetSendQ().SetUserQueue(!localuser->HasPrivPermission("users/flood/increased-buffers"));
+	}
+
 	FOREACH_MOD(OnPostOper, (this, oper->name, opername));
 }
 
@@ -473,6 +531,10 @@ void User::UnOper()
 	 */
 	oper = NULL;
 
+	LocalUser* localuser = IS_LOCAL(this);
+	if (localuser)
+		localuser->eh.GetSendQ().SetUserQueue(true);
+
 	// Remove the user from the oper list
 	stdalgo::vector::swaperase(ServerInstance->Users.all_opers, this);
 
@@ -613,6 +675,10 @@ void User::InvalidateCache()
 	cached_hostip.clear();
 	cached_makehost.clear();
 	cached_fullrealhost.clear();
+
+	// The NAMES entries of this user are generated from the above.
+	for (Membership* memb : chans)
+		memb->chan->memberserial++;
 }
 
 bool User::ChangeNick(const std::string& newnick, time_t newts)
@@ -672,8 +738,22 @@ bool User::ChangeNick(const std::string& newnick, time_t newts)
 	nick = newnick;
 
 	InvalidateCache();
-	ServerInstance->Users.clientlist.erase(oldnick);
-	ServerInstance->Users.clientlist[newnick] = this;
+
+	// Move the existing entry to the new nick instead of freeing it and allocating a new one.
+	user_hash& clientlist = ServerInstance->Users.clientlist;
+	user_hash::node_type node = clientlist.extract(oldnick);
+	bool moved = false;
+	if (node)
+	{
+		node.key() = newnick;
+		node.mapped() = this;
+		moved = clientlist.insert(std::move(node)).inserted;
+	}
+
+	// If the new nick is still mapped to another user (e.g. a collided one
+	// which has not been removed yet) the entry must point to us instead.
+	if (!moved)
+		clientlist[newnick] = this;
 
 	if (registered == REG_ALL)
 		FOREACH_MOD(OnUserPostNick, (this,oldnick));
@@ -870,8 +950,29 @@ void User::WriteNumeric(const Numeric::Numeric& numeric)
 	if (MOD_RESULT == MOD_RES_DENY)
 		return;
 
-	ClientProtocol::Messages::Numeric numericmsg(numeric, localuser);
-	localuser->Send(ServerInstance->GetRFCEvents().numeric, numericmsg);
+	localuser->SendNumeric(numeric);
+}
+
+void LocalUser::SendNumeric(const Numeric::Numeric& numeric)
+{
+	// Numerics are by far the most common message sent to users so if nothing can hook or add tags
+	// to them skip building a message and write them straight to the send queue. Every in-tree tag
+	// provider only sends tags to users who have negotiated a capability.
+	ClientProtocol::EventProvider& numericevprov = ServerInstance->GetRFCEvents().numeric;
+	if (serializer && numericevprov.GetSubscribers().empty() && ServerInstance->Modules.EventHandlers[I_OnUserWrite].empty()
+		&& (!capabilities || !serializer->HasTagProviders()))
+	{
+		// Write() copies the line into the send queue so the buffer can be reused by every numeric.
+		static std::string line;
+		if (serializer->SerializeNumeric(this, numeric, line))
+		{
+			Write(line);
+			return;
+		}
+	}
+
+	ClientProtocol::Messages::Numeric numericmsg(numeric, this);
+	Send(numericevprov, numericmsg);
 }
 
 void User::WriteRemoteNotice(const std::string& text)
@@ -1145,8 +1246,8 @@ void LocalUser::SetClass(const std::string &explicit_name)
 			}
 
 			/* check if host matches.. */
-			if (!InspIRCd::MatchCIDR(this->GetIPString(), c->GetHost(), NULL) &&
-				!InspIRCd::MatchCIDR(this->GetRealHost(), c->GetHost(), NULL))
+			if (!c->hostaddr.match(this->client_sa, this->GetIPString()) &&
+				!InspIRCd::Match(this->GetRealHost(), c->GetHost(), NULL))
 			{
 				ServerInstance->Logs.Log("CONNECTCLASS", LOG_DEBUG, "The %s connect class is not suitable as neither the host (%s) nor the IP (%s) matches %s",
 					c->GetName().c_str(), this->GetRealHost().c_str(), this->GetIPString().c_str(), c->GetHost().c_str());
@@ -1237,6 +1338,7 @@ ConnectClass::ConnectClass(std::shared_ptr<ConfigTag> tag, char t, const std::st
 	, type(t)
 	, name("unnamed")
 	, host(mask)
+	, hostaddr(mask)
 {
 }
 
@@ -1246,6 +1348,7 @@ ConnectClass::ConnectClass(std::shared_ptr<ConfigTag> tag, char t, const std::st
 	name = "unnamed";
 	type = t;
 	host = mask;
+	hostaddr = mask;
 
 	// Connect classes can inherit from each other but this is problematic for modules which can't use
 	// ConnectClass::Update so we build a hybrid tag containing all of the values set on this class as
@@ -1277,6 +1380,7 @@ void ConnectClass::Update(const std::shared_ptr<ConnectClass> src)
 	name = src->name;
 	registration_timeout = src->registration_timeout;
 	host = src->host;
+	hostaddr = src->hostaddr;
 	pingtime = src->pingtime;
 	softsendqmax = src->softsendqmax;
 	hardsendqmax = src->hardsendqmax;
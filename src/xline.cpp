@@ -580,8 +580,8 @@ bool KLine::Matches(User *u)
 
 	if (InspIRCd::Match(u->ident, this->identmask, ascii_case_insensitive_map))
 	{
-		if (InspIRCd::MatchCIDR(u->GetRealHost(), this->hostmask, ascii_case_insensitive_map) ||
-			InspIRCd::MatchCIDR(u->GetIPString(), this->hostmask, ascii_case_insensitive_map))
+		if (InspIRCd::Match(u->GetRealHost(), this->hostmask, ascii_case_insensitive_map) ||
+			this->hostaddr.match(u->client_sa, u->GetIPString()))
 		{
 			return true;
 		}
@@ -603,8 +603,8 @@ bool GLine::Matches(User *u)
 
 	if (InspIRCd::Match(u->ident, this->identmask, ascii_case_insensitive_map))
 	{
-		if (InspIRCd::MatchCIDR(u->GetRealHost(), this->hostmask, ascii_case_insensitive_map) ||
-			InspIRCd::MatchCIDR(u->GetIPString(), this->hostmask, ascii_case_insensitive_map))
+		if (InspIRCd::Match(u->GetRealHost(), this->hostmask, ascii_case_insensitive_map) ||
+			this->hostaddr.match(u->client_sa, u->GetIPString()))
 		{
 			return true;
 		}
@@ -622,8 +622,8 @@ bool ELine::Matches(User *u)
 {
 	if (InspIRCd::Match(u->ident, this->identmask, ascii_case_insensitive_map))
 	{
-		if (InspIRCd::MatchCIDR(u->GetRealHost(), this->hostmask, ascii_case_insensitive_map) ||
-			InspIRCd::MatchCIDR(u->GetIPString(), this->hostmask, ascii_case_insensitive_map))
+		if (InspIRCd::Match(u->GetRealHost(), this->hostmask, ascii_case_insensitive_map) ||
+			this->hostaddr.match(u->client_sa, u->GetIPString()))
 		{
 			return true;
 		}
@@ -638,7 +638,7 @@ bool ZLine::Matches(User *u)
 	if (lu && lu->exempt)
 		return false;
 
-	if (InspIRCd::MatchCIDR(u->GetIPString(), this->ipaddr))
+	if (this->ipmask.match(u->client_sa, u->GetIPString()))
 		return true;
 	else
 		return false;